@@ -11,6 +11,7 @@ int** GraphsGenerating::incMatrix = nullptr;
 int GraphsGenerating::numVertices = 0;
 int GraphsGenerating::numEdges = 0;
 slistEl** GraphsGenerating::adjList = nullptr;
+unsigned long long GraphsGenerating::graphVersion = 0;
 
 // Define the directory path for the input files
 const char* DIRECTORY_PATH = "C:\\Users\\10122\\CLionProjects\\GraphEfficiency\\resources\\";
@@ -56,6 +57,7 @@ void GraphsGenerating::loadGraphFromFile() {
     }
 
     fclose(inputFile);
+    markModified();
 }
 
 /**
@@ -183,6 +185,7 @@ void GraphsGenerating::generateRandomGraph(int vertices, int density) {
     }
 
     delete[] verticesList;
+    markModified();
 }
 
 /**
@@ -211,4 +214,15 @@ void GraphsGenerating::freeMemory() {
         delete[] adjList;
         adjList = nullptr;
     }
+    markModified();
+}
+
+/**
+ * @brief Marks the graph as changed.
+ *
+ * Every function that loads, generates or edits the graph calls this, so cached algorithm results keyed by an
+ * older version are never returned for the new graph.
+ */
+void GraphsGenerating::markModified() {
+    graphVersion++;
 }
@@ -33,6 +33,8 @@ struct slistEl {
  * Number of edges in the graph.
  * @var GraphsGenerating::adjList
  * Adjacency list of the graph.
+ * @var GraphsGenerating::graphVersion
+ * Version of the graph, bumped by every load, generation or mutation.
  */
 class GraphsGenerating {
 public:
@@ -40,6 +42,7 @@ public:
     static int numVertices;
     static int numEdges;
     static slistEl** adjList;
+    static unsigned long long graphVersion;
 
     /**
      * @brief Loads a graph from a file.
@@ -67,6 +70,11 @@ public:
      * @brief Frees the memory allocated for the graph.
      */
     static void freeMemory();
+
+    /**
+     * @brief Marks the graph as changed, so results computed for an earlier version are no longer used.
+     */
+    static void markModified();
 };
 
 #endif // GRAPHSGENERATING_H
\ No newline at end of file
@@ -0,0 +1,331 @@
+/**
+ * @file ResultCache.cpp
+ * @brief This file contains the implementation of the ResultCache class.
+ */
+
+#include "ResultCache.h"
+#include "GraphsGenerating.h"
+#include <iostream>
+#include <list>
+
+using namespace std;
+
+/**
+ * @struct CacheEntry
+ * @brief One cached result together with its key.
+ */
+struct CacheEntry {
+    unsigned long long version; // Graph version the result belongs to
+    int algorithm;
+    int representation;
+    int variant; // Configuration of the algorithm, 0 for the default one
+    int firstParam; // Source vertex, or -1
+    int secondParam; // Sink vertex, or -1
+    int value; // MST weight or maximum flow
+    int *dist; // Shortest distances, or nullptr
+    int *prev; // Previous vertices, or nullptr
+    ResultCache::Edge *edges; // Spanning tree edges, or nullptr
+    bool *cut; // Source side of a minimum cut, or nullptr
+    int length; // Number of entries in the arrays above
+    size_t bytes; // Memory held by the entry
+};
+
+// Most recently used entries first
+static list<CacheEntry> entries;
+static size_t usedBytes = 0;
+static size_t memoryCap = 64u * 1024u * 1024u;
+static bool benchmarkMode = true;
+static long long hits = 0;
+static long long misses = 0;
+
+/**
+ * @brief Frees the arrays of an entry.
+ * @param entry The entry.
+ */
+static void releaseEntry(CacheEntry &entry) {
+    delete[] entry.dist;
+    delete[] entry.prev;
+    delete[] entry.edges;
+    delete[] entry.cut;
+    usedBytes -= entry.bytes;
+}
+
+/**
+ * @brief Evicts least recently used entries until the cache fits under its memory cap.
+ */
+static void evict() {
+    while (usedBytes > memoryCap && !entries.empty()) {
+        releaseEntry(entries.back());
+        entries.pop_back();
+    }
+}
+
+/**
+ * @brief Finds the entry for a key among the results of the current graph version and marks it as recently used.
+ * @return The entry, or nullptr on a miss.
+ */
+static CacheEntry* findEntry(int algorithm, int representation, int variant, int firstParam, int secondParam) {
+    for (auto it = entries.begin(); it != entries.end(); ++it) {
+        if (it->version == GraphsGenerating::graphVersion && it->algorithm == algorithm &&
+            it->representation == representation && it->variant == variant && it->firstParam == firstParam && it->secondParam == secondParam) {
+            entries.splice(entries.begin(), entries, it);
+            hits++;
+            return &entries.front();
+        }
+    }
+    misses++;
+    return nullptr;
+}
+
+/**
+ * @brief Inserts an entry, replacing any entry with the same key and dropping entries of older graph versions.
+ * @param entry The entry; the cache takes ownership of its arrays.
+ */
+static void insertEntry(CacheEntry entry) {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->version != GraphsGenerating::graphVersion ||
+            (it->algorithm == entry.algorithm && it->representation == entry.representation &&
+             it->variant == entry.variant && it->firstParam == entry.firstParam && it->secondParam == entry.secondParam)) {
+            releaseEntry(*it);
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (entry.bytes > memoryCap) {
+        delete[] entry.dist;
+        delete[] entry.prev;
+        delete[] entry.edges;
+        delete[] entry.cut;
+        return;
+    }
+    usedBytes += entry.bytes;
+    entries.push_front(entry);
+    evict();
+}
+
+/**
+ * @brief Creates an entry with the key filled in and no payload.
+ */
+static CacheEntry makeEntry(int algorithm, int representation, int variant, int firstParam, int secondParam) {
+    CacheEntry entry;
+    entry.version = GraphsGenerating::graphVersion;
+    entry.algorithm = algorithm;
+    entry.representation = representation;
+    entry.variant = variant;
+    entry.firstParam = firstParam;
+    entry.secondParam = secondParam;
+    entry.value = 0;
+    entry.dist = nullptr;
+    entry.prev = nullptr;
+    entry.edges = nullptr;
+    entry.cut = nullptr;
+    entry.length = 0;
+    entry.bytes = sizeof(CacheEntry);
+    return entry;
+}
+
+/**
+ * @brief Stores a shortest path tree.
+ * @param algorithm The algorithm that produced the result.
+ * @param representation The graph representation it ran on.
+ * @param source The source vertex.
+ * @param dist The array of shortest distances.
+ * @param prev The array of previous vertices.
+ * @param numVertices The number of vertices in the graph.
+ * @param variant The configuration of the algorithm, 0 for the default one.
+ */
+void ResultCache::StoreShortestPaths(Algorithm algorithm, Representation representation, int source,
+                                     const int *dist, const int *prev, int numVertices, int variant) {
+    if (benchmarkMode || dist == nullptr || prev == nullptr) {
+        return;
+    }
+    CacheEntry entry = makeEntry(algorithm, representation, variant, source, -1);
+    entry.dist = new int[numVertices];
+    entry.prev = new int[numVertices];
+    for (int i = 0; i < numVertices; i++) {
+        entry.dist[i] = dist[i];
+        entry.prev[i] = prev[i];
+    }
+    entry.length = numVertices;
+    entry.bytes += 2 * sizeof(int) * numVertices;
+    insertEntry(entry);
+}
+
+/**
+ * @brief Looks up a shortest path tree.
+ * @param algorithm The algorithm that produced the result.
+ * @param representation The graph representation it ran on.
+ * @param source The source vertex.
+ * @param variant The configuration of the algorithm, 0 for the default one.
+ * @return Freshly allocated copies of the dist and prev arrays, or a pair of nullptr on a miss.
+ */
+pair<int*, int*> ResultCache::LookupShortestPaths(Algorithm algorithm, Representation representation, int source,
+                                                  int variant) {
+    if (benchmarkMode) {
+        return make_pair(nullptr, nullptr);
+    }
+    CacheEntry *entry = findEntry(algorithm, representation, variant, source, -1);
+    if (entry == nullptr) {
+        return make_pair(nullptr, nullptr);
+    }
+    int* dist = new int[entry->length];
+    int* prev = new int[entry->length];
+    for (int i = 0; i < entry->length; i++) {
+        dist[i] = entry->dist[i];
+        prev[i] = entry->prev[i];
+    }
+    return make_pair(dist, prev);
+}
+
+/**
+ * @brief Stores a minimum spanning tree.
+ * @param algorithm The algorithm that produced the result.
+ * @param representation The graph representation it ran on.
+ * @param weight The total weight of the tree.
+ * @param edges The edges of the tree.
+ * @param count The number of edges.
+ * @param variant The configuration of the algorithm, 0 for the default one.
+ */
+void ResultCache::StoreSpanningTree(Algorithm algorithm, Representation representation, int weight,
+                                    const Edge *edges, int count, int variant) {
+    if (benchmarkMode) {
+        return;
+    }
+    CacheEntry entry = makeEntry(algorithm, representation, variant, -1, -1);
+    entry.value = weight;
+    entry.edges = new Edge[count > 0 ? count : 1];
+    for (int i = 0; i < count; i++) {
+        entry.edges[i] = edges[i];
+    }
+    entry.length = count;
+    entry.bytes += sizeof(Edge) * count;
+    insertEntry(entry);
+}
+
+/**
+ * @brief Looks up a minimum spanning tree.
+ * @param algorithm The algorithm that produced the result.
+ * @param representation The graph representation it ran on.
+ * @param weight Output: the total weight of the tree.
+ * @param edges Output: the edges of the tree, valid until the cache changes.
+ * @param count Output: the number of edges.
+ * @param variant The configuration of the algorithm, 0 for the default one.
+ * @return True on a hit, false otherwise.
+ */
+bool ResultCache::LookupSpanningTree(Algorithm algorithm, Representation representation, int *weight,
+                                     const Edge **edges, int *count, int variant) {
+    if (benchmarkMode) {
+        return false;
+    }
+    CacheEntry *entry = findEntry(algorithm, representation, variant, -1, -1);
+    if (entry == nullptr) {
+        return false;
+    }
+    *weight = entry->value;
+    *edges = entry->edges;
+    *count = entry->length;
+    return true;
+}
+
+/**
+ * @brief Stores a maximum flow value and, if known, the source side of a minimum cut.
+ * @param algorithm The algorithm that produced the result.
+ * @param representation The graph representation it ran on.
+ * @param source The source vertex.
+ * @param sink The sink vertex.
+ * @param maxFlow The maximum flow value.
+ * @param sourceSide Flags of the vertices on the source side of the cut, or nullptr.
+ * @param numVertices The number of vertices in the graph.
+ * @param variant The configuration of the algorithm, 0 for the default one.
+ */
+void ResultCache::StoreMaxFlow(Algorithm algorithm, Representation representation, int source, int sink,
+                               int maxFlow, const bool *sourceSide, int numVertices, int variant) {
+    if (benchmarkMode) {
+        return;
+    }
+    CacheEntry entry = makeEntry(algorithm, representation, variant, source, sink);
+    entry.value = maxFlow;
+    if (sourceSide != nullptr) {
+        entry.cut = new bool[numVertices];
+        for (int i = 0; i < numVertices; i++) {
+            entry.cut[i] = sourceSide[i];
+        }
+        entry.length = numVertices;
+        entry.bytes += sizeof(bool) * numVertices;
+    }
+    insertEntry(entry);
+}
+
+/**
+ * @brief Looks up a maximum flow result.
+ * @param algorithm The algorithm that produced the result.
+ * @param representation The graph representation it ran on.
+ * @param source The source vertex.
+ * @param sink The sink vertex.
+ * @param maxFlow Output: the maximum flow value.
+ * @param sourceSide Output: the cut flags, or nullptr if the producer did not report a cut.
+ * @param variant The configuration of the algorithm, 0 for the default one.
+ * @return True on a hit, false otherwise.
+ */
+bool ResultCache::LookupMaxFlow(Algorithm algorithm, Representation representation, int source, int sink,
+                                int *maxFlow, const bool **sourceSide, int variant) {
+    if (benchmarkMode) {
+        return false;
+    }
+    CacheEntry *entry = findEntry(algorithm, representation, variant, source, sink);
+    if (entry == nullptr) {
+        return false;
+    }
+    *maxFlow = entry->value;
+    *sourceSide = entry->cut;
+    return true;
+}
+
+/**
+ * @brief Enables or disables benchmark mode; in benchmark mode the cache is neither read nor written.
+ * @param enabled True to bypass the cache.
+ */
+void ResultCache::SetBenchmarkMode(bool enabled) {
+    benchmarkMode = enabled;
+}
+
+/**
+ * @brief Checks whether benchmark mode is on.
+ * @return True if the cache is bypassed.
+ */
+bool ResultCache::IsBenchmarkMode() {
+    return benchmarkMode;
+}
+
+/**
+ * @brief Sets the memory cap, evicting entries if the cache is over it.
+ * @param bytes The maximum number of bytes held by cached results.
+ */
+void ResultCache::SetMemoryCap(size_t bytes) {
+    memoryCap = bytes;
+    evict();
+}
+
+/**
+ * @brief Removes all entries.
+ */
+void ResultCache::Clear() {
+    for (CacheEntry &entry : entries) {
+        releaseEntry(entry);
+    }
+    entries.clear();
+    hits = 0;
+    misses = 0;
+}
+
+/**
+ * @brief Prints the number of entries, their memory use and the hit statistics.
+ */
+void ResultCache::PrintStatistics() {
+    cout << "Benchmark mode: " << (benchmarkMode ? "on (cache bypassed)" : "off") << endl;
+    cout << "Graph version: " << GraphsGenerating::graphVersion << endl;
+    cout << "Entries: " << entries.size() << endl;
+    cout << "Memory: " << usedBytes << " of " << memoryCap << " bytes" << endl;
+    cout << "Hits: " << hits << ", misses: " << misses << endl;
+}
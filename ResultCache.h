@@ -0,0 +1,164 @@
+/**
+ * @file ResultCache.h
+ * @brief This file contains the declaration of the ResultCache class.
+ */
+
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include <cstddef>
+#include <utility>
+
+/**
+ * @class ResultCache
+ * @brief Class caching algorithm results for the current version of the graph.
+ *
+ * Entries are keyed by (graph version, algorithm, representation, variant, parameters), so any load, generation or
+ * mutation of the graph makes older entries unreachable. The variant distinguishes configurations of one algorithm
+ * (a heap or dense Prim, a sort strategy, a selection rule), so a run of one configuration is never answered with
+ * the result of another. The cache evicts least recently used entries once its memory cap is exceeded. Benchmark
+ * mode is on by default: the cache is then bypassed completely, so measured times always include the computation.
+ */
+class ResultCache {
+public:
+    /**
+     * @enum Algorithm
+     * @brief The algorithm that produced a result.
+     */
+    enum Algorithm {
+        DIJKSTRA,
+        BELLMAN_FORD,
+        PRIM,
+        KRUSKAL,
+        FORD_FULKERSON_DFS,
+        FORD_FULKERSON_BFS,
+        DINIC,
+        PUSH_RELABEL
+    };
+
+    /**
+     * @enum Representation
+     * @brief The graph representation the algorithm ran on.
+     */
+    enum Representation {
+        MATRIX,
+        LIST
+    };
+
+    /**
+     * @struct Edge
+     * @brief An edge of a cached spanning tree.
+     */
+    struct Edge {
+        int src; ///< The source vertex of the edge
+        int dest; ///< The destination vertex of the edge
+        int weight; ///< The weight of the edge
+    };
+
+    /**
+     * @brief Stores a shortest path tree.
+     * @param algorithm The algorithm that produced the result.
+     * @param representation The graph representation it ran on.
+     * @param source The source vertex.
+     * @param dist The array of shortest distances.
+     * @param prev The array of previous vertices.
+     * @param numVertices The number of vertices in the graph.
+     * @param variant The configuration of the algorithm, 0 for the default one.
+     */
+    static void StoreShortestPaths(Algorithm algorithm, Representation representation, int source,
+                                   const int *dist, const int *prev, int numVertices, int variant = 0);
+
+    /**
+     * @brief Looks up a shortest path tree.
+     * @param algorithm The algorithm that produced the result.
+     * @param representation The graph representation it ran on.
+     * @param source The source vertex.
+     * @param variant The configuration of the algorithm, 0 for the default one.
+     * @return Freshly allocated copies of the dist and prev arrays, or a pair of nullptr on a miss.
+     */
+    static std::pair<int*, int*> LookupShortestPaths(Algorithm algorithm, Representation representation, int source,
+                                                     int variant = 0);
+
+    /**
+     * @brief Stores a minimum spanning tree.
+     * @param algorithm The algorithm that produced the result.
+     * @param representation The graph representation it ran on.
+     * @param weight The total weight of the tree.
+     * @param edges The edges of the tree.
+     * @param count The number of edges.
+     * @param variant The configuration of the algorithm, 0 for the default one.
+     */
+    static void StoreSpanningTree(Algorithm algorithm, Representation representation, int weight,
+                                  const Edge *edges, int count, int variant = 0);
+
+    /**
+     * @brief Looks up a minimum spanning tree.
+     * @param algorithm The algorithm that produced the result.
+     * @param representation The graph representation it ran on.
+     * @param weight Output: the total weight of the tree.
+     * @param edges Output: the edges of the tree, valid until the cache changes.
+     * @param count Output: the number of edges.
+     * @param variant The configuration of the algorithm, 0 for the default one.
+     * @return True on a hit, false otherwise.
+     */
+    static bool LookupSpanningTree(Algorithm algorithm, Representation representation, int *weight,
+                                   const Edge **edges, int *count, int variant = 0);
+
+    /**
+     * @brief Stores a maximum flow value and, if known, the source side of a minimum cut.
+     * @param algorithm The algorithm that produced the result.
+     * @param representation The graph representation it ran on.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param maxFlow The maximum flow value.
+     * @param sourceSide Flags of the vertices on the source side of the cut, or nullptr.
+     * @param numVertices The number of vertices in the graph.
+     * @param variant The configuration of the algorithm, 0 for the default one.
+     */
+    static void StoreMaxFlow(Algorithm algorithm, Representation representation, int source, int sink,
+                             int maxFlow, const bool *sourceSide, int numVertices, int variant = 0);
+
+    /**
+     * @brief Looks up a maximum flow result.
+     * @param algorithm The algorithm that produced the result.
+     * @param representation The graph representation it ran on.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param maxFlow Output: the maximum flow value.
+     * @param sourceSide Output: the cut flags, or nullptr if the producer did not report a cut.
+     * @param variant The configuration of the algorithm, 0 for the default one.
+     * @return True on a hit, false otherwise.
+     */
+    static bool LookupMaxFlow(Algorithm algorithm, Representation representation, int source, int sink,
+                              int *maxFlow, const bool **sourceSide, int variant = 0);
+
+    /**
+     * @brief Enables or disables benchmark mode; in benchmark mode the cache is neither read nor written.
+     * @param enabled True to bypass the cache.
+     */
+    static void SetBenchmarkMode(bool enabled);
+
+    /**
+     * @brief Checks whether benchmark mode is on.
+     * @return True if the cache is bypassed.
+     */
+    static bool IsBenchmarkMode();
+
+    /**
+     * @brief Sets the memory cap, evicting entries if the cache is over it.
+     * @param bytes The maximum number of bytes held by cached results.
+     */
+    static void SetMemoryCap(size_t bytes);
+
+    /**
+     * @brief Removes all entries.
+     */
+    static void Clear();
+
+    /**
+     * @brief Prints the number of entries, their memory use and the hit statistics.
+     */
+    static void PrintStatistics();
+};
+
+#endif // RESULTCACHE_H
@@ -5,12 +5,29 @@
 
 #include "SimulationOptions.h"
 #include "GraphsGenerating.h"
+#include "ResultCache.h"
 #include "graphsAlgorithms/Prim.h"
 #include "graphsAlgorithms/Kruskal.h"
+#include "graphsAlgorithms/Boruvka.h"
+#include "graphsAlgorithms/EdgeListBuilder.h"
+#include "graphsAlgorithms/ConcurrentUnionFind.h"
+#include "graphsAlgorithms/DynamicMST.h"
+#include "graphsAlgorithms/MSTWeightEstimator.h"
+#include "graphsAlgorithms/StreamingMST.h"
+#include "graphsAlgorithms/ExternalKruskal.h"
 #include "graphsAlgorithms/Dijkstra.h"
 #include "graphsAlgorithms/BellmanFord.h"
 #include "graphsAlgorithms/FordFulkersonDFS.h"
 #include "graphsAlgorithms/FordFulkersonBFS.h"
+#include "graphsAlgorithms/Dinic.h"
+#include "graphsAlgorithms/PushRelabel.h"
+#include "graphsAlgorithms/AStarLandmarks.h"
+#include "graphsAlgorithms/SSSPBatchRunner.h"
+#include "graphsAlgorithms/DynamicSSSP.h"
+#include "graphsAlgorithms/ParallelBellmanFord.h"
+#include "graphsAlgorithms/NegativeCycleDetector.h"
+#include "graphsAlgorithms/Johnson.h"
+#include "graphsAlgorithms/FloydWarshall.h"
 #include <iostream>
 
 using namespace std;
@@ -35,6 +52,7 @@ void SimulationOptions::runMenu() {
         cout << "| 1 - Compute the Minimum Spanning Tree (MST)       |" << endl;
         cout << "| 2 - Compute the shortest path                     |" << endl;
         cout << "| 3 - Compute the the maximum flow                  |" << endl;
+        cout << "| 4 - Result cache settings                         |" << endl;
         cout << "|---------------------------------------------------|" << endl;
         cout << "| 0 - Exit the program                              |" << endl;
         cout << "|---------------------------------------------------|" << endl;
@@ -51,6 +69,12 @@ void SimulationOptions::runMenu() {
                     cout << "|---------------------------------------------------|" << endl;
                     cout << "| 1 - Prim's algorithm                              |" << endl;
                     cout << "| 2 - Kruskal's algorithm                           |" << endl;
+                    cout << "| 3 - Parallel Boruvka (adjacency list)             |" << endl;
+                    cout << "| 4 - Concurrent union-find benchmark and stress    |" << endl;
+                    cout << "| 5 - Dynamic MST under edge updates                |" << endl;
+                    cout << "| 6 - Approximate MST weight (vertex sampling)      |" << endl;
+                    cout << "| 7 - Semi-streaming MST from an edge file          |" << endl;
+                    cout << "| 8 - External-memory Kruskal (on-disk sort)        |" << endl;
                     cout << "|---------------------------------------------------|" << endl;
                     cout << "| 0 - Back to the main menu                         |" << endl;
                     cout << "|---------------------------------------------------|" << endl;
@@ -70,6 +94,10 @@ void SimulationOptions::runMenu() {
                                 cout << "| 3 - Print existed graph                           |" << endl;
                                 cout << "| 4 - Run the algorithm for adjacency matrix        |" << endl;
                                 cout << "| 5 - Run the algorithm for adjacency list          |" << endl;
+                                cout << "| 6 - Run for adjacency list (lazy heap)            |" << endl;
+                                cout << "| 7 - Run for adjacency list (dense O(V^2) scan)    |" << endl;
+                                cout << "| 8 - Compare heap and dense variants (list)        |" << endl;
+                                cout << "| 9 - Run vectorized dense Prim (weight matrix)     |" << endl;
                                 cout << "|---------------------------------------------------|" << endl;
                                 cout << "| 0 - Back to the previous menu                     |" << endl;
                                 cout << "|---------------------------------------------------|" << endl;
@@ -97,6 +125,22 @@ void SimulationOptions::runMenu() {
                                         cout << "Run Prim's algorithm for computing minimal spanning tree" << endl;
                                         Prim::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices);
                                         break;
+                                    case 6:
+                                        cout << "Run Prim's algorithm with a lazy heap" << endl;
+                                        Prim::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices, Prim::LAZY_HEAP);
+                                        break;
+                                    case 7:
+                                        cout << "Run Prim's algorithm with the dense minKey scan" << endl;
+                                        Prim::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices, Prim::DENSE_SCAN);
+                                        break;
+                                    case 8:
+                                        cout << "Compare Prim's heap and dense variants" << endl;
+                                        Prim::CompareListVariants(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                                        break;
+                                    case 9:
+                                        cout << "Run dense Prim with vectorized argmin on the weight matrix" << endl;
+                                        Prim::TimeCounterDense(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                                        break;
                                     case 0:
                                         cout << "Back to the previous menu" << endl;
                                         break;
@@ -118,6 +162,12 @@ void SimulationOptions::runMenu() {
                                 cout << "| 3 - Print existed graph                           |" << endl;
                                 cout << "| 4 - Run the algorithm for adjacency matrix        |" << endl;
                                 cout << "| 5 - Run the algorithm for adjacency list          |" << endl;
+                                cout << "| 6 - Run Filter-Kruskal for adjacency matrix       |" << endl;
+                                cout << "| 7 - Run Filter-Kruskal for adjacency list         |" << endl;
+                                cout << "| 8 - Compare full sort and Filter-Kruskal (list)   |" << endl;
+                                cout << "| 9 - Choose the edge sort strategy                 |" << endl;
+                                cout << "| 10 - Compare edge sort strategies (list)          |" << endl;
+                                cout << "| 11 - Parallel edge extraction and sort            |" << endl;
                                 cout << "|---------------------------------------------------|" << endl;
                                 cout << "| 0 - Back to the previous menu                     |" << endl;
                                 cout << "|---------------------------------------------------|" << endl;
@@ -145,6 +195,29 @@ void SimulationOptions::runMenu() {
                                         cout << "Run Kruskal's algorithm for computing minimal spanning tree" << endl;
                                         Kruskal::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices);
                                         break;
+                                    case 6:
+                                        cout << "Run Filter-Kruskal for computing minimal spanning tree" << endl;
+                                        Kruskal::TimeCounterMatrix(GraphsGenerating::incMatrix, GraphsGenerating::numVertices, GraphsGenerating::numEdges, true);
+                                        break;
+                                    case 7:
+                                        cout << "Run Filter-Kruskal for computing minimal spanning tree" << endl;
+                                        Kruskal::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices, true);
+                                        break;
+                                    case 8:
+                                        cout << "Compare Kruskal's full sort with Filter-Kruskal" << endl;
+                                        Kruskal::CompareWithFilter(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                                        break;
+                                    case 9:
+                                        Kruskal::ChooseSortStrategy();
+                                        break;
+                                    case 10:
+                                        cout << "Compare the edge sort strategies" << endl;
+                                        Kruskal::CompareSortStrategies(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                                        break;
+                                    case 11:
+                                        cout << "Build the sorted edge array in parallel and share it between MST variants" << endl;
+                                        EdgeListBuilder::TimeCounter(GraphsGenerating::incMatrix, GraphsGenerating::adjList, GraphsGenerating::numVertices, GraphsGenerating::numEdges);
+                                        break;
                                     case 0:
                                         cout << "Back to the previous menu" << endl;
                                         break;
@@ -155,6 +228,30 @@ void SimulationOptions::runMenu() {
                             } while (kruskalChoice != 0);
                             break;
                         }
+                        case 3:
+                            cout << "Run parallel Boruvka's algorithm for computing minimal spanning tree" << endl;
+                            Boruvka::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                            break;
+                        case 4:
+                            cout << "Benchmark and stress test the concurrent union-find" << endl;
+                            ConcurrentUnionFind::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                            break;
+                        case 5:
+                            cout << "Maintain the minimum spanning tree under random edge updates" << endl;
+                            DynamicMST::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                            break;
+                        case 6:
+                            cout << "Estimate the minimum spanning tree weight from sampled vertices" << endl;
+                            MSTWeightEstimator::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                            break;
+                        case 7:
+                            cout << "Compute the minimum spanning tree of an edge stream in one pass" << endl;
+                            StreamingMST::TimeCounterStream(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                            break;
+                        case 8:
+                            cout << "Compute the minimum spanning tree of an edge file larger than memory" << endl;
+                            ExternalKruskal::TimeCounterFile(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                            break;
                         case 0:
                             cout << "Back to the main menu" << endl;
                             break;
@@ -173,6 +270,9 @@ void SimulationOptions::runMenu() {
                     cout << "|---------------------------------------------------|" << endl;
                     cout << "| 1 - Dijkstra's algorithm                          |" << endl;
                     cout << "| 2 - Bellman-Ford algorithm                        |" << endl;
+                    cout << "| 3 - Batch shortest paths from many sources        |" << endl;
+                    cout << "| 4 - All-pairs shortest paths (Johnson)            |" << endl;
+                    cout << "| 5 - All-pairs shortest paths (Floyd-Warshall)     |" << endl;
                     cout << "|---------------------------------------------------|" << endl;
                     cout << "| 0 - Back to the main menu                         |" << endl;
                     cout << "|---------------------------------------------------|" << endl;
@@ -192,6 +292,8 @@ void SimulationOptions::runMenu() {
                                 cout << "| 3 - Print existed graph                           |" << endl;
                                 cout << "| 4 - Run the algorithm for adjacency matrix        |" << endl;
                                 cout << "| 5 - Run the algorithm for adjacency list          |" << endl;
+                                cout << "| 6 - Run landmark A* (ALT) for adjacency list      |" << endl;
+                                cout << "| 7 - Repair paths after edge updates (list)        |" << endl;
                                 cout << "|---------------------------------------------------|" << endl;
                                 cout << "| 0 - Back to the previous menu                     |" << endl;
                                 cout << "|---------------------------------------------------|" << endl;
@@ -222,6 +324,14 @@ void SimulationOptions::runMenu() {
                                         Dijkstra::TimeCounterList(GraphsGenerating::adjList,
                                                                   GraphsGenerating::numVertices, 0);
                                         break;
+                                    case 6:
+                                        cout << "Run landmark A* (ALT) for point-to-point shortest paths" << endl;
+                                        AStarLandmarks::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                                        break;
+                                    case 7:
+                                        cout << "Run incremental shortest path repair after edge updates" << endl;
+                                        DynamicSSSP::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices, 0);
+                                        break;
 
                                     case 0:
                                         cout << "Back to the previous menu" << endl;
@@ -244,6 +354,11 @@ void SimulationOptions::runMenu() {
                                 cout << "| 3 - Print existed graph                           |" << endl;
                                 cout << "| 4 - Run the algorithm for adjacency matrix        |" << endl;
                                 cout << "| 5 - Run the algorithm for adjacency list          |" << endl;
+                                cout << "| 6 - Compare sweeps with queue-based (SPFA) run    |" << endl;
+                                cout << "| 7 - Parallel push/pull scaling (adjacency list)   |" << endl;
+                                cout << "| 8 - Compare with SIMD edge-array passes           |" << endl;
+                                cout << "| 9 - Compare Yen vertex orderings (passes)         |" << endl;
+                                cout << "| 10 - Detect negative cycles early (list)          |" << endl;
                                 cout << "|---------------------------------------------------|" << endl;
                                 cout << "| 0 - Back to the previous menu                     |" << endl;
                                 cout << "|---------------------------------------------------|" << endl;
@@ -272,6 +387,26 @@ void SimulationOptions::runMenu() {
                                         cout << "Run Bellman-Ford algorithm for computing shortest path" << endl;
                                         BellmanFord::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices, 0);
                                         break;
+                                    case 6:
+                                        cout << "Compare Bellman-Ford sweeps with the queue-based variant" << endl;
+                                        BellmanFord::CompareQueueAndSweep(GraphsGenerating::adjList, GraphsGenerating::numVertices, 0);
+                                        break;
+                                    case 7:
+                                        cout << "Run parallel Bellman-Ford in push and pull mode" << endl;
+                                        ParallelBellmanFord::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices, 0);
+                                        break;
+                                    case 8:
+                                        cout << "Run Bellman-Ford over structure-of-arrays edge lists" << endl;
+                                        BellmanFord::TimeCounterEdgeArrays(GraphsGenerating::incMatrix, GraphsGenerating::adjList, GraphsGenerating::numVertices, GraphsGenerating::numEdges, 0);
+                                        break;
+                                    case 9:
+                                        cout << "Compare Bellman-Ford vertex orderings" << endl;
+                                        BellmanFord::CompareVertexOrderings(GraphsGenerating::adjList, GraphsGenerating::numVertices, 0);
+                                        break;
+                                    case 10:
+                                        cout << "Search for negative-weight cycles with subtree disassembly" << endl;
+                                        NegativeCycleDetector::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices, 0);
+                                        break;
                                     case 0:
                                         cout << "Back to the previous menu" << endl;
                                         break;
@@ -282,6 +417,18 @@ void SimulationOptions::runMenu() {
                             } while (bellmanFordChoice != 0);
                             break;
                         }
+                        case 3:
+                            cout << "Run batch shortest paths on a thread pool" << endl;
+                            SSSPBatchRunner::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                            break;
+                        case 4:
+                            cout << "Run Johnson's algorithm for all-pairs shortest paths" << endl;
+                            Johnson::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                            break;
+                        case 5:
+                            cout << "Run cache-blocked Floyd-Warshall for all-pairs shortest paths" << endl;
+                            FloydWarshall::TimeCounterList(GraphsGenerating::adjList, GraphsGenerating::numVertices);
+                            break;
                         case 0:
                             cout << "Back to the main menu" << endl;
                             break;
@@ -300,6 +447,8 @@ void SimulationOptions::runMenu() {
                     cout << "|---------------------------------------------------|" << endl;
                     cout << "| 1 - Ford-Fulkerson algorithm DFS                  |" << endl;
                     cout << "| 2 - Ford-Fulkerson algorithm BFS                  |" << endl;
+                    cout << "| 3 - Dinic's algorithm                             |" << endl;
+                    cout << "| 4 - Push-relabel algorithm                        |" << endl;
                     cout << "|---------------------------------------------------|" << endl;
                     cout << "| 0 - Back to the main menu                         |" << endl;
                     cout << "|---------------------------------------------------|" << endl;
@@ -406,6 +555,109 @@ void SimulationOptions::runMenu() {
                             } while (fordFulkersonBFSChoice != 0);
                             break;
                         }
+                        case 3: {
+                            int dinicChoice;
+                            do {
+                                cout << "|---------------------------------------------------|" << endl;
+                                cout << "|       CHOOSE THE OPTION FOR DINIC'S ALGORITHM     |" << endl;
+                                cout << "|---------------------------------------------------|" << endl;
+                                cout << "| 1 - Load graph from file                          |" << endl;
+                                cout << "| 2 - Generate random graph                         |" << endl;
+                                cout << "| 3 - Print existed graph                           |" << endl;
+                                cout << "| 4 - Run the algorithm for adjacency list          |" << endl;
+                                cout << "| 5 - Compare with Ford-Fulkerson BFS               |" << endl;
+                                cout << "|---------------------------------------------------|" << endl;
+                                cout << "| 0 - Back to the previous menu                     |" << endl;
+                                cout << "|---------------------------------------------------|" << endl;
+                                cout << "Enter your choice: ";
+                                cin >> dinicChoice;
+                                cout << endl;
+
+                                switch (dinicChoice) {
+                                    case 1:
+                                        cout << "Load graph from file" << endl;
+                                        GraphsGenerating::loadGraphFromFile();
+                                        break;
+                                    case 2:
+                                        randomGraphGeneratorMenu();
+                                        break;
+                                    case 3:
+                                        cout << "Print existed graph" << endl;
+                                        GraphsGenerating::printIncidenceMatrix();
+                                        GraphsGenerating::printAdjacencyList();
+                                        break;
+                                    case 4:
+                                        cout << "Run Dinic's algorithm for computing maximum flow" << endl;
+                                        Dinic::TimeCounterList(GraphsGenerating::adjList, 0, GraphsGenerating::numVertices - 1, GraphsGenerating::numVertices);
+                                        break;
+                                    case 5:
+                                        cout << "Compare Dinic's algorithm with Ford-Fulkerson BFS" << endl;
+                                        Dinic::CompareWithFordFulkerson(GraphsGenerating::adjList, 0, GraphsGenerating::numVertices - 1, GraphsGenerating::numVertices);
+                                        break;
+                                    case 0:
+                                        cout << "Back to the previous menu" << endl;
+                                        break;
+                                    default:
+                                        cout << "Invalid choice. Please try again." << endl;
+                                        break;
+                                }
+                            } while (dinicChoice != 0);
+                            break;
+                        }
+                        case 4: {
+                            int pushRelabelChoice;
+                            do {
+                                cout << "|---------------------------------------------------|" << endl;
+                                cout << "|      CHOOSE THE OPTION FOR PUSH-RELABEL ALGORITHM |" << endl;
+                                cout << "|---------------------------------------------------|" << endl;
+                                cout << "| 1 - Load graph from file                          |" << endl;
+                                cout << "| 2 - Generate random graph                         |" << endl;
+                                cout << "| 3 - Print existed graph                           |" << endl;
+                                cout << "| 4 - Run highest-label push-relabel                |" << endl;
+                                cout << "| 5 - Run FIFO push-relabel                         |" << endl;
+                                cout << "| 6 - Compare with Dinic's algorithm                |" << endl;
+                                cout << "|---------------------------------------------------|" << endl;
+                                cout << "| 0 - Back to the previous menu                     |" << endl;
+                                cout << "|---------------------------------------------------|" << endl;
+                                cout << "Enter your choice: ";
+                                cin >> pushRelabelChoice;
+                                cout << endl;
+
+                                switch (pushRelabelChoice) {
+                                    case 1:
+                                        cout << "Load graph from file" << endl;
+                                        GraphsGenerating::loadGraphFromFile();
+                                        break;
+                                    case 2:
+                                        randomGraphGeneratorMenu();
+                                        break;
+                                    case 3:
+                                        cout << "Print existed graph" << endl;
+                                        GraphsGenerating::printIncidenceMatrix();
+                                        GraphsGenerating::printAdjacencyList();
+                                        break;
+                                    case 4:
+                                        cout << "Run highest-label push-relabel for computing maximum flow" << endl;
+                                        PushRelabel::TimeCounterList(GraphsGenerating::adjList, 0, GraphsGenerating::numVertices - 1, GraphsGenerating::numVertices, PushRelabel::HIGHEST_LABEL);
+                                        break;
+                                    case 5:
+                                        cout << "Run FIFO push-relabel for computing maximum flow" << endl;
+                                        PushRelabel::TimeCounterList(GraphsGenerating::adjList, 0, GraphsGenerating::numVertices - 1, GraphsGenerating::numVertices, PushRelabel::FIFO);
+                                        break;
+                                    case 6:
+                                        cout << "Compare push-relabel with Dinic's algorithm" << endl;
+                                        PushRelabel::CompareEngines(GraphsGenerating::adjList, 0, GraphsGenerating::numVertices - 1, GraphsGenerating::numVertices);
+                                        break;
+                                    case 0:
+                                        cout << "Back to the previous menu" << endl;
+                                        break;
+                                    default:
+                                        cout << "Invalid choice. Please try again." << endl;
+                                        break;
+                                }
+                            } while (pushRelabelChoice != 0);
+                            break;
+                        }
                         case 0:
                             cout << "Back to the main menu" << endl;
                             break;
@@ -416,6 +668,9 @@ void SimulationOptions::runMenu() {
                 } while (maxFlowChoice != 0);
                 break;
             }
+            case 4:
+                resultCacheMenu();
+                break;
             case 0:
                 cout << "Exiting the program..." << endl;
                 break;
@@ -442,4 +697,57 @@ void SimulationOptions::randomGraphGeneratorMenu() {
     cin >> density;
     cout << endl;
     GraphsGenerating::generateRandomGraph(vertices, density);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Runs the menu for configuring the result cache.
+ *
+ * The user can switch benchmark mode (which bypasses the cache so every run is measured), change the memory cap,
+ * drop all cached results or print the cache statistics.
+ */
+void SimulationOptions::resultCacheMenu() {
+    int cacheChoice;
+    do {
+        cout << "|---------------------------------------------------|" << endl;
+        cout << "|               RESULT CACHE SETTINGS               |" << endl;
+        cout << "|---------------------------------------------------|" << endl;
+        cout << "| 1 - Toggle benchmark mode (bypass the cache)      |" << endl;
+        cout << "| 2 - Set memory cap (MB)                           |" << endl;
+        cout << "| 3 - Clear the cache                               |" << endl;
+        cout << "| 4 - Print cache statistics                        |" << endl;
+        cout << "|---------------------------------------------------|" << endl;
+        cout << "| 0 - Back to the main menu                         |" << endl;
+        cout << "|---------------------------------------------------|" << endl;
+        cout << "Enter your choice: ";
+        cin >> cacheChoice;
+        cout << endl;
+
+        switch (cacheChoice) {
+            case 1:
+                ResultCache::SetBenchmarkMode(!ResultCache::IsBenchmarkMode());
+                cout << "Benchmark mode " << (ResultCache::IsBenchmarkMode() ? "enabled" : "disabled") << endl;
+                break;
+            case 2: {
+                cout << "Enter the memory cap (in MB): ";
+                long long megabytes;
+                cin >> megabytes;
+                cout << endl;
+                ResultCache::SetMemoryCap(megabytes > 0 ? (size_t) megabytes * 1024 * 1024 : 0);
+                break;
+            }
+            case 3:
+                ResultCache::Clear();
+                cout << "Cache cleared" << endl;
+                break;
+            case 4:
+                ResultCache::PrintStatistics();
+                break;
+            case 0:
+                cout << "Back to the main menu" << endl;
+                break;
+            default:
+                cout << "Invalid choice. Please try again." << endl;
+                break;
+        }
+    } while (cacheChoice != 0);
+}
@@ -17,6 +17,11 @@ private:
      * @brief This function runs the menu for generating random graphs.
      */
     static void randomGraphGeneratorMenu();
+
+    /**
+     * @brief This function runs the menu for configuring the result cache.
+     */
+    static void resultCacheMenu();
 };
 
 #endif //GRAPHEFFICIENCY_SIMULATIONOPTIONS_H
\ No newline at end of file
@@ -0,0 +1,531 @@
+/**
+ * @file AStarLandmarks.cpp
+ * @brief This file contains the implementation of the AStarLandmarks class.
+ */
+
+#include "AStarLandmarks.h"
+#include "Dijkstra.h"
+#include <iostream>
+#include <climits>
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+
+// Sentinel for unreachable entries in the 16-bit tables
+static const unsigned short COMPACT_INFINITY = 0xFFFF;
+
+// Initialize static members
+int* AStarLandmarks::landmarks = nullptr;
+int AStarLandmarks::numLandmarks = 0;
+int AStarLandmarks::tableVertices = 0;
+bool AStarLandmarks::compact = false;
+unsigned short* AStarLandmarks::from16 = nullptr;
+unsigned short* AStarLandmarks::to16 = nullptr;
+int* AStarLandmarks::from32 = nullptr;
+int* AStarLandmarks::to32 = nullptr;
+
+/**
+ * @brief Builds the reversed adjacency list of a graph.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @return The adjacency list with every edge reversed.
+ */
+static slistEl** reverseAdjList(slistEl **adjList, int numVertices) {
+    slistEl **reversed = new slistEl*[numVertices]();
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            slistEl *r = new slistEl;
+            r->v = u;
+            r->weight = p->weight;
+            r->next = reversed[p->v];
+            reversed[p->v] = r;
+        }
+    }
+    return reversed;
+}
+
+/**
+ * @brief Frees an adjacency list built by reverseAdjList.
+ * @param list The adjacency list.
+ * @param numVertices The number of vertices in the graph.
+ */
+static void freeAdjList(slistEl **list, int numVertices) {
+    for (int i = 0; i < numVertices; i++) {
+        slistEl *p = list[i];
+        while (p) {
+            slistEl *r = p;
+            p = p->next;
+            delete r;
+        }
+    }
+    delete[] list;
+}
+
+/**
+ * @brief Lower bound on d(a, b) derived from full-width landmark distance rows.
+ * @param a The first vertex.
+ * @param b The second vertex.
+ * @param selected The number of landmarks with computed rows.
+ * @param fromDist Distances from the landmarks, one row per landmark.
+ * @param toDist Distances to the landmarks, one row per landmark.
+ * @return A lower bound on the distance from a to b.
+ */
+static int rowLowerBound(int a, int b, int selected, int **fromDist, int **toDist) {
+    int best = 0;
+    for (int l = 0; l < selected; l++) {
+        if (fromDist[l][a] != INT_MAX && fromDist[l][b] != INT_MAX) {
+            best = max(best, fromDist[l][b] - fromDist[l][a]);
+        }
+        if (toDist[l][a] != INT_MAX && toDist[l][b] != INT_MAX) {
+            best = max(best, toDist[l][a] - toDist[l][b]);
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Chooses the next landmark with the "avoid" heuristic.
+ *
+ * A shortest path tree is grown from a random root. Every vertex is weighted by how much the current landmarks
+ * underestimate its distance from the root, and subtrees that already contain a landmark are discarded. The walk
+ * then descends from the root into the heaviest subtree and returns the leaf it reaches.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param selected The number of landmarks selected so far.
+ * @param fromDist Distances from the selected landmarks, one row per landmark.
+ * @param toDist Distances to the selected landmarks, one row per landmark.
+ * @return The vertex chosen as the next landmark.
+ */
+int AStarLandmarks::selectAvoid(slistEl **adjList, int numVertices, int selected, int **fromDist, int **toDist) {
+    int root = rand() % numVertices;
+    pair<int*, int*> tree = Dijkstra::AlgorithmCalculationFromList(adjList, numVertices, root);
+    int* dist = tree.first;
+    int* prev = tree.second;
+
+    // Children of every vertex in the shortest path tree, in CSR form
+    int* childStart = new int[numVertices + 1]();
+    for (int v = 0; v < numVertices; v++) {
+        if (prev[v] != -1) {
+            childStart[prev[v] + 1]++;
+        }
+    }
+    for (int v = 0; v < numVertices; v++) {
+        childStart[v + 1] += childStart[v];
+    }
+    int* children = new int[numVertices];
+    int* fill = new int[numVertices];
+    for (int v = 0; v < numVertices; v++) {
+        fill[v] = childStart[v];
+    }
+    for (int v = 0; v < numVertices; v++) {
+        if (prev[v] != -1) {
+            children[fill[prev[v]]++] = v;
+        }
+    }
+
+    bool* isLandmark = new bool[numVertices]();
+    for (int l = 0; l < selected; l++) {
+        isLandmark[landmarks[l]] = true;
+    }
+
+    // Preorder of the tree, so that walking it backwards visits children before parents
+    int* order = new int[numVertices];
+    int orderSize = 0;
+    int* stack = fill;
+    int top = 0;
+    stack[top++] = root;
+    while (top > 0) {
+        int u = stack[--top];
+        order[orderSize++] = u;
+        for (int c = childStart[u]; c < childStart[u + 1]; c++) {
+            stack[top++] = children[c];
+        }
+    }
+
+    long long* size = new long long[numVertices]();
+    bool* covered = new bool[numVertices]();
+    for (int i = orderSize - 1; i >= 0; i--) {
+        int u = order[i];
+        covered[u] = isLandmark[u];
+        long long sum = dist[u] - rowLowerBound(root, u, selected, fromDist, toDist);
+        for (int c = childStart[u]; c < childStart[u + 1]; c++) {
+            covered[u] = covered[u] || covered[children[c]];
+            sum += size[children[c]];
+        }
+        size[u] = covered[u] ? 0 : sum;
+    }
+
+    int leaf = root;
+    while (true) {
+        int next = -1;
+        for (int c = childStart[leaf]; c < childStart[leaf + 1]; c++) {
+            int child = children[c];
+            if (size[child] > 0 && (next == -1 || size[child] > size[next])) {
+                next = child;
+            }
+        }
+        if (next == -1) break;
+        leaf = next;
+    }
+
+    // Every subtree is already covered: fall back to any vertex that is not a landmark yet
+    if (isLandmark[leaf]) {
+        for (int v = 0; v < numVertices; v++) {
+            if (!isLandmark[v]) {
+                leaf = v;
+                break;
+            }
+        }
+    }
+
+    delete[] dist;
+    delete[] prev;
+    delete[] childStart;
+    delete[] children;
+    delete[] fill;
+    delete[] isLandmark;
+    delete[] order;
+    delete[] size;
+    delete[] covered;
+    return leaf;
+}
+
+/**
+ * @brief Selects the landmarks and precomputes the distances from and to each of them.
+ *
+ * The distances from a landmark come from Dijkstra's algorithm on the graph, the distances to a landmark from
+ * Dijkstra's algorithm on the reversed graph. The tables are kept vertex-major, so the bounds of one vertex are
+ * contiguous at query time, and narrowed to 16 bits when the largest finite distance fits.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param k The number of landmarks to select.
+ * @param method The landmark selection heuristic.
+ */
+void AStarLandmarks::Preprocess(slistEl **adjList, int numVertices, int k, SelectionMethod method) {
+    FreeLandmarks();
+    if (numVertices <= 0 || k <= 0) {
+        return;
+    }
+    if (k > numVertices) {
+        k = numVertices;
+    }
+
+    slistEl **reversed = reverseAdjList(adjList, numVertices);
+    int **fromDist = new int*[k];
+    int **toDist = new int*[k];
+    landmarks = new int[k];
+    bool* isLandmark = new bool[numVertices]();
+
+    // The farthest heuristic starts from the vertex farthest away from a random one
+    int* closest = new int[numVertices];
+    pair<int*, int*> initial = Dijkstra::AlgorithmCalculationFromList(adjList, numVertices, rand() % numVertices);
+    for (int v = 0; v < numVertices; v++) {
+        closest[v] = initial.first[v];
+    }
+    delete[] initial.first;
+    delete[] initial.second;
+
+    for (int l = 0; l < k; l++) {
+        int chosen = -1;
+        if (method == AVOID) {
+            chosen = selectAvoid(adjList, numVertices, l, fromDist, toDist);
+        } else {
+            for (int v = 0; v < numVertices; v++) {
+                if (!isLandmark[v] && (chosen == -1 || closest[v] > closest[chosen])) {
+                    chosen = v;
+                }
+            }
+        }
+        landmarks[l] = chosen;
+        isLandmark[chosen] = true;
+
+        pair<int*, int*> from = Dijkstra::AlgorithmCalculationFromList(adjList, numVertices, chosen);
+        pair<int*, int*> to = Dijkstra::AlgorithmCalculationFromList(reversed, numVertices, chosen);
+        fromDist[l] = from.first;
+        toDist[l] = to.first;
+        delete[] from.second;
+        delete[] to.second;
+
+        for (int v = 0; v < numVertices; v++) {
+            closest[v] = (l == 0) ? fromDist[l][v] : min(closest[v], fromDist[l][v]);
+        }
+    }
+
+    int maxFinite = 0;
+    for (int l = 0; l < k; l++) {
+        for (int v = 0; v < numVertices; v++) {
+            if (fromDist[l][v] != INT_MAX) maxFinite = max(maxFinite, fromDist[l][v]);
+            if (toDist[l][v] != INT_MAX) maxFinite = max(maxFinite, toDist[l][v]);
+        }
+    }
+
+    numLandmarks = k;
+    tableVertices = numVertices;
+    compact = maxFinite < COMPACT_INFINITY;
+    if (compact) {
+        from16 = new unsigned short[numVertices * k];
+        to16 = new unsigned short[numVertices * k];
+    } else {
+        from32 = new int[numVertices * k];
+        to32 = new int[numVertices * k];
+    }
+    for (int v = 0; v < numVertices; v++) {
+        for (int l = 0; l < k; l++) {
+            int idx = v * k + l;
+            if (compact) {
+                from16[idx] = fromDist[l][v] == INT_MAX ? COMPACT_INFINITY : (unsigned short) fromDist[l][v];
+                to16[idx] = toDist[l][v] == INT_MAX ? COMPACT_INFINITY : (unsigned short) toDist[l][v];
+            } else {
+                from32[idx] = fromDist[l][v];
+                to32[idx] = toDist[l][v];
+            }
+        }
+    }
+
+    for (int l = 0; l < k; l++) {
+        delete[] fromDist[l];
+        delete[] toDist[l];
+    }
+    delete[] fromDist;
+    delete[] toDist;
+    delete[] isLandmark;
+    delete[] closest;
+    freeAdjList(reversed, numVertices);
+}
+
+/**
+ * @brief Reads the distance from landmark l to vertex v.
+ * @param v The vertex.
+ * @param l The landmark index.
+ * @return The stored distance, or INT_MAX if v is unreachable from the landmark.
+ */
+int AStarLandmarks::distFromLandmark(int v, int l) {
+    if (compact) {
+        unsigned short d = from16[v * numLandmarks + l];
+        return d == COMPACT_INFINITY ? INT_MAX : d;
+    }
+    return from32[v * numLandmarks + l];
+}
+
+/**
+ * @brief Reads the distance from vertex v to landmark l.
+ * @param v The vertex.
+ * @param l The landmark index.
+ * @return The stored distance, or INT_MAX if the landmark is unreachable from v.
+ */
+int AStarLandmarks::distToLandmark(int v, int l) {
+    if (compact) {
+        unsigned short d = to16[v * numLandmarks + l];
+        return d == COMPACT_INFINITY ? INT_MAX : d;
+    }
+    return to32[v * numLandmarks + l];
+}
+
+/**
+ * @brief Computes the landmark lower bound on the distance between two vertices.
+ *
+ * By the triangle inequality d(v, t) >= d(L, t) - d(L, v) and d(v, t) >= d(v, L) - d(t, L) for every landmark L.
+ * Terms involving an unreachable entry are skipped.
+ *
+ * @param v The vertex the bound starts from.
+ * @param target The target vertex.
+ * @return A lower bound on the distance from v to target.
+ */
+int AStarLandmarks::LowerBound(int v, int target) {
+    int best = 0;
+    for (int l = 0; l < numLandmarks; l++) {
+        int fromV = distFromLandmark(v, l);
+        int fromT = distFromLandmark(target, l);
+        if (fromV != INT_MAX && fromT != INT_MAX) {
+            best = max(best, fromT - fromV);
+        }
+        int toV = distToLandmark(v, l);
+        int toT = distToLandmark(target, l);
+        if (toV != INT_MAX && toT != INT_MAX) {
+            best = max(best, toV - toT);
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Shared A* search; with useLandmarks set to false it degenerates to Dijkstra's algorithm.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param source The source vertex.
+ * @param target The target vertex.
+ * @param settled Output: the number of vertices settled by the search.
+ * @param useLandmarks Whether the landmark lower bounds guide the search.
+ * @return The shortest distance from source to target, or INT_MAX if the target is unreachable.
+ */
+int AStarLandmarks::search(slistEl **adjList, int numVertices, int source, int target, int *settled, bool useLandmarks) {
+    int* dist = new int[numVertices];
+    int* key = new int[numVertices];
+    int* bound = new int[numVertices];
+    for (int i = 0; i < numVertices; i++) {
+        dist[i] = INT_MAX;
+        key[i] = INT_MAX;
+        bound[i] = -1; // Lower bounds are computed lazily, once per vertex
+    }
+
+    *settled = 0;
+    dist[source] = 0;
+    key[source] = useLandmarks ? LowerBound(source, target) : 0;
+    PriorityQueue pq(numVertices, key);
+    pq.push(source);
+
+    while (!pq.isEmpty()) {
+        int u = pq.pop();
+        (*settled)++;
+        if (u == target) break;
+
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            int v = p->v;
+            int candidate = dist[u] + p->weight;
+            if (candidate < dist[v]) {
+                if (bound[v] == -1) {
+                    bound[v] = useLandmarks ? LowerBound(v, target) : 0;
+                }
+                dist[v] = candidate;
+                key[v] = candidate + bound[v];
+                pq.push(v);
+            }
+        }
+    }
+
+    int result = dist[target];
+    delete[] dist;
+    delete[] key;
+    delete[] bound;
+    return result;
+}
+
+/**
+ * @brief Answers a point-to-point query with A* search guided by the landmark lower bounds.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param source The source vertex.
+ * @param target The target vertex.
+ * @param settled Output: the number of vertices settled by the search.
+ * @return The shortest distance from source to target, or INT_MAX if the target is unreachable.
+ */
+int AStarLandmarks::Query(slistEl **adjList, int numVertices, int source, int target, int *settled) {
+    return search(adjList, numVertices, source, target, settled, numLandmarks > 0 && tableVertices == numVertices);
+}
+
+/**
+ * @brief Answers a point-to-point query with plain Dijkstra's algorithm stopped at the target.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param source The source vertex.
+ * @param target The target vertex.
+ * @param settled Output: the number of vertices settled by the search.
+ * @return The shortest distance from source to target, or INT_MAX if the target is unreachable.
+ */
+int AStarLandmarks::DijkstraQuery(slistEl **adjList, int numVertices, int source, int target, int *settled) {
+    return search(adjList, numVertices, source, target, settled, false);
+}
+
+/**
+ * @brief Frees the landmark tables.
+ */
+void AStarLandmarks::FreeLandmarks() {
+    delete[] landmarks;
+    delete[] from16;
+    delete[] to16;
+    delete[] from32;
+    delete[] to32;
+    landmarks = nullptr;
+    from16 = nullptr;
+    to16 = nullptr;
+    from32 = nullptr;
+    to32 = nullptr;
+    numLandmarks = 0;
+    tableVertices = 0;
+    compact = false;
+}
+
+/**
+ * @brief Runs the preprocessing and a series of random queries, comparing ALT against plain Dijkstra.
+ *
+ * The settled-vertex counts of both searches are reported so the number of landmarks can be tuned per graph.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+void AStarLandmarks::TimeCounterList(slistEl **adjList, int numVertices) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Give number of landmarks: ";
+    int k;
+    cin >> k;
+    cout << "Choose landmark selection (1 - farthest, 2 - avoid): ";
+    int method;
+    cin >> method;
+    cout << "Give number of random queries: ";
+    int queries;
+    cin >> queries;
+    cout << endl;
+
+    auto start = chrono::high_resolution_clock::now();
+    Preprocess(adjList, numVertices, k, method == 2 ? AVOID : FARTHEST);
+    auto end = chrono::high_resolution_clock::now();
+    chrono::duration<double> preprocessing = end - start;
+
+    int entryBytes = compact ? (int) sizeof(unsigned short) : (int) sizeof(int);
+    cout << "Landmarks:";
+    for (int l = 0; l < numLandmarks; l++) {
+        cout << " " << landmarks[l];
+    }
+    cout << endl;
+    cout << "Preprocessing time: " << preprocessing.count() * 1000 << " ms" << endl;
+    cout << "Table entries: " << entryBytes * 8 << "-bit, "
+         << 2LL * numLandmarks * numVertices * entryBytes << " bytes" << endl;
+
+    long long altSettled = 0, dijkstraSettled = 0;
+    double altTime = 0, dijkstraTime = 0;
+    int mismatches = 0;
+    for (int q = 0; q < queries; q++) {
+        int source = rand() % numVertices;
+        int target = rand() % numVertices;
+        int settled;
+
+        start = chrono::high_resolution_clock::now();
+        int altDist = Query(adjList, numVertices, source, target, &settled);
+        end = chrono::high_resolution_clock::now();
+        altTime += chrono::duration<double>(end - start).count();
+        altSettled += settled;
+
+        start = chrono::high_resolution_clock::now();
+        int dijkstraDist = DijkstraQuery(adjList, numVertices, source, target, &settled);
+        end = chrono::high_resolution_clock::now();
+        dijkstraTime += chrono::duration<double>(end - start).count();
+        dijkstraSettled += settled;
+
+        if (queries == 1) {
+            cout << "Distance " << source << " -> " << target << ": ";
+            if (altDist == INT_MAX) cout << "No path" << endl;
+            else cout << altDist << endl;
+        }
+        if (altDist != dijkstraDist) {
+            mismatches++;
+        }
+    }
+
+    if (queries > 0) {
+        printf("%-12s%-22s%s\n", "Search", "Avg settled vertices", "Avg time");
+        printf("%-12s%-22.1f%.3f ms\n", "ALT", (double) altSettled / queries, altTime / queries * 1000);
+        printf("%-12s%-22.1f%.3f ms\n", "Dijkstra", (double) dijkstraSettled / queries, dijkstraTime / queries * 1000);
+        if (altSettled > 0) {
+            printf("Settled-vertex reduction: %.2fx\n", (double) dijkstraSettled / altSettled);
+        }
+        if (mismatches > 0) {
+            printf("Distance mismatches: %d\n", mismatches);
+        }
+    }
+}
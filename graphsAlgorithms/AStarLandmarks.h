@@ -0,0 +1,131 @@
+/**
+ * @file AStarLandmarks.h
+ * @brief This file contains the declaration of the AStarLandmarks class.
+ */
+
+#ifndef ASTARLANDMARKS_H
+#define ASTARLANDMARKS_H
+
+#include "../GraphsGenerating.h"
+
+/**
+ * @class AStarLandmarks
+ * @brief Class implementing landmark-based A* search (ALT) for point-to-point shortest path queries.
+ *
+ * A set of landmarks is selected in a preprocessing step and the distances from and to every landmark are
+ * computed with Dijkstra's algorithm. Queries then run A* guided by the triangle-inequality lower bounds
+ * derived from these distances. The tables are stored with 16-bit entries whenever every finite distance fits.
+ */
+class AStarLandmarks {
+public:
+    /**
+     * @enum SelectionMethod
+     * @brief Heuristic used to choose the landmarks.
+     */
+    enum SelectionMethod {
+        FARTHEST = 1, ///< Each new landmark is the vertex farthest from the already selected ones
+        AVOID = 2 ///< The "avoid" heuristic: grow a landmark in the region the current bounds cover worst
+    };
+
+    /**
+     * @brief Selects the landmarks and precomputes the distances from and to each of them.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param k The number of landmarks to select.
+     * @param method The landmark selection heuristic.
+     */
+    static void Preprocess(slistEl **adjList, int numVertices, int k, SelectionMethod method);
+
+    /**
+     * @brief Answers a point-to-point query with A* search guided by the landmark lower bounds.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param source The source vertex.
+     * @param target The target vertex.
+     * @param settled Output: the number of vertices settled by the search.
+     * @return The shortest distance from source to target, or INT_MAX if the target is unreachable.
+     */
+    static int Query(slistEl **adjList, int numVertices, int source, int target, int *settled);
+
+    /**
+     * @brief Answers a point-to-point query with plain Dijkstra's algorithm stopped at the target.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param source The source vertex.
+     * @param target The target vertex.
+     * @param settled Output: the number of vertices settled by the search.
+     * @return The shortest distance from source to target, or INT_MAX if the target is unreachable.
+     */
+    static int DijkstraQuery(slistEl **adjList, int numVertices, int source, int target, int *settled);
+
+    /**
+     * @brief Computes the landmark lower bound on the distance between two vertices.
+     * @param v The vertex the bound starts from.
+     * @param target The target vertex.
+     * @return A lower bound on the distance from v to target.
+     */
+    static int LowerBound(int v, int target);
+
+    /**
+     * @brief Frees the landmark tables.
+     */
+    static void FreeLandmarks();
+
+    /**
+     * @brief Runs the preprocessing and a series of random queries, comparing ALT against plain Dijkstra.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices);
+
+private:
+    /**
+     * @brief Reads the distance from landmark l to vertex v.
+     * @param v The vertex.
+     * @param l The landmark index.
+     * @return The stored distance, or INT_MAX if v is unreachable from the landmark.
+     */
+    static int distFromLandmark(int v, int l);
+
+    /**
+     * @brief Reads the distance from vertex v to landmark l.
+     * @param v The vertex.
+     * @param l The landmark index.
+     * @return The stored distance, or INT_MAX if the landmark is unreachable from v.
+     */
+    static int distToLandmark(int v, int l);
+
+    /**
+     * @brief Shared A* search; with useLandmarks set to false it degenerates to Dijkstra's algorithm.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param source The source vertex.
+     * @param target The target vertex.
+     * @param settled Output: the number of vertices settled by the search.
+     * @param useLandmarks Whether the landmark lower bounds guide the search.
+     * @return The shortest distance from source to target, or INT_MAX if the target is unreachable.
+     */
+    static int search(slistEl **adjList, int numVertices, int source, int target, int *settled, bool useLandmarks);
+
+    /**
+     * @brief Chooses the next landmark with the "avoid" heuristic.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param selected The number of landmarks selected so far.
+     * @param fromDist Distances from the selected landmarks, one row per landmark.
+     * @param toDist Distances to the selected landmarks, one row per landmark.
+     * @return The vertex chosen as the next landmark.
+     */
+    static int selectAvoid(slistEl **adjList, int numVertices, int selected, int **fromDist, int **toDist);
+
+    static int *landmarks; // The selected landmark vertices
+    static int numLandmarks; // Number of selected landmarks
+    static int tableVertices; // Number of vertices the tables were built for
+    static bool compact; // True if the tables use 16-bit entries
+    static unsigned short *from16; // d(landmark, v), 16-bit, stored as [v * numLandmarks + l]
+    static unsigned short *to16; // d(v, landmark), 16-bit, stored as [v * numLandmarks + l]
+    static int *from32; // d(landmark, v), 32-bit fallback
+    static int *to32; // d(v, landmark), 32-bit fallback
+};
+
+#endif // ASTARLANDMARKS_H
@@ -1,10 +1,17 @@
 #include "BellmanFord.h"
+#include "EdgeArrays.h"
+#include "NegativeCycleDetector.h"
+#include "SimdKernels.h"
+#include "../ResultCache.h"
 #include <iostream>
 #include <climits>
 #include <chrono>
+#include <cstdlib>
+#include <string>
 
 using namespace std;
 
+
 /**
  * @brief Executes the Bellman-Ford algorithm on a graph represented as an incidence matrix.
  * @param incMatrix The incidence matrix representing the graph.
@@ -95,15 +102,39 @@ pair<int*, int*> BellmanFord::AlgorithmCalculationFromList(slistEl** adjList, in
     int* dist = new int[numVertices];
     int* prev = new int[numVertices];
 
+    if (!AlgorithmCalculationFromList(adjList, numVertices, startVertex, dist, prev)) {
+        printf("Graph contains a negative-weight cycle\n");
+        delete[] dist;
+        delete[] prev;
+        return make_pair(nullptr, nullptr);
+    }
+
+    return make_pair(dist, prev);
+}
+
+/**
+ * @brief Executes the Bellman-Ford algorithm on an adjacency list using caller-owned buffers.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param startVertex The starting vertex for the algorithm.
+ * @param dist Output array of shortest distances.
+ * @param prev Output array of previous vertices.
+ * @param passCount Optional output of the number of relaxation passes done.
+ * @return False if a negative-weight cycle is reachable from the start vertex, true otherwise.
+ */
+bool BellmanFord::AlgorithmCalculationFromList(slistEl** adjList, int numVertices, int startVertex, int* dist, int* prev,
+                                              int* passCount) {
     for (int i = 0; i < numVertices; i++) {
         dist[i] = INT_MAX;
         prev[i] = -1;
     }
 
     dist[startVertex] = 0;
+    int passes = 0;
 
     for (int i = 1; i <= numVertices - 1; i++) {
         bool updated = false;
+        passes++;
         for (int u = 0; u < numVertices; u++) {
             for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
                 int v = p->v;
@@ -117,21 +148,289 @@ pair<int*, int*> BellmanFord::AlgorithmCalculationFromList(slistEl** adjList, in
         }
         if (!updated) break;
     }
+    if (passCount) *passCount = passes;
 
     for (int u = 0; u < numVertices; u++) {
         for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
             int v = p->v;
             int weight = p->weight;
             if (dist[u] != INT_MAX && dist[u] + weight < dist[v]) {
-                printf("Graph contains a negative-weight cycle\n");
-                delete[] dist;
-                delete[] prev;
-                return make_pair(nullptr, nullptr);
+                return false;
             }
         }
     }
 
-    return make_pair(dist, prev);
+    return true;
+}
+
+/**
+ * @brief Executes the queue-based Bellman-Ford algorithm (SPFA) with the SLF and LLL heuristics.
+ *
+ * Only the out-edges of vertices whose distance improved are relaxed. The queue is a ring buffer used as a deque:
+ * Small-Label-First puts an improved vertex at the front when its distance is below the front's, and
+ * Large-Label-Last rotates the front to the back while its distance is above the queue average. Each vertex
+ * remembers how many edges its tentative path has; a path of numVertices edges repeats a vertex, which can only
+ * happen along a negative cycle.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param startVertex The starting vertex for the algorithm.
+ * @param dist Output array of shortest distances.
+ * @param prev Output array of previous vertices.
+ * @param scanCount Optional output of the number of vertex scans done.
+ * @param relaxationCount Optional output of the number of edges examined.
+ * @return False if a negative-weight cycle is reachable from the start vertex, true otherwise.
+ */
+bool BellmanFord::AlgorithmCalculationFromListQueue(slistEl** adjList, int numVertices, int startVertex, int* dist, int* prev,
+                                                   long long* scanCount, long long* relaxationCount) {
+    int* queue = new int[numVertices];
+    bool* inQueue = new bool[numVertices];
+    int* pathLength = new int[numVertices];
+    for (int i = 0; i < numVertices; i++) {
+        dist[i] = INT_MAX;
+        prev[i] = -1;
+        inQueue[i] = false;
+        pathLength[i] = 0;
+    }
+
+    dist[startVertex] = 0;
+    queue[0] = startVertex;
+    inQueue[startVertex] = true;
+    int head = 0, size = 1;
+    long long queueSum = 0; // Sum of the distances of the queued vertices, for LLL
+    long long scans = 0, relaxations = 0;
+    bool negativeCycle = false;
+
+    while (size > 0 && !negativeCycle) {
+        // Large-Label-Last: move heavy vertices from the front to the back
+        for (int rotations = 0; rotations < size && (long long) dist[queue[head]] * size > queueSum; rotations++) {
+            queue[(head + size) % numVertices] = queue[head];
+            head = (head + 1) % numVertices;
+        }
+        int u = queue[head];
+        head = (head + 1) % numVertices;
+        size--;
+        queueSum -= dist[u];
+        inQueue[u] = false;
+        scans++;
+
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            int v = p->v;
+            relaxations++;
+            if (dist[u] + p->weight >= dist[v]) continue;
+            if (inQueue[v]) {
+                queueSum -= dist[v];
+            }
+            dist[v] = dist[u] + p->weight;
+            prev[v] = u;
+            pathLength[v] = pathLength[u] + 1;
+            if (pathLength[v] >= numVertices) {
+                negativeCycle = true;
+                break;
+            }
+            if (inQueue[v]) {
+                queueSum += dist[v];
+                continue;
+            }
+            // Small-Label-First: a vertex better than the front is scanned next
+            if (size > 0 && dist[v] < dist[queue[head]]) {
+                head = (head + numVertices - 1) % numVertices;
+                queue[head] = v;
+            } else {
+                queue[(head + size) % numVertices] = v;
+            }
+            size++;
+            queueSum += dist[v];
+            inQueue[v] = true;
+        }
+    }
+
+    delete[] queue;
+    delete[] inQueue;
+    delete[] pathLength;
+    if (scanCount) *scanCount = scans;
+    if (relaxationCount) *relaxationCount = relaxations;
+    return !negativeCycle;
+}
+
+/**
+ * @brief Executes the Bellman-Ford algorithm with Yen's vertex ordering.
+ *
+ * The vertices are put in a fixed order and every edge is classified as forward (from an earlier to a later
+ * vertex) or backward. A pass relaxes the forward edges of the vertices in increasing order and then the backward
+ * edges in decreasing order, so each half of a pass follows a DAG and carries improvements along whole runs of
+ * same-direction edges. A shortest path alternates direction at most V-1 times, which bounds the number of passes
+ * by about V/2. Ordering the vertices randomly lowers the expected number of direction changes further.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param startVertex The starting vertex for the algorithm.
+ * @param dist Output array of shortest distances.
+ * @param prev Output array of previous vertices.
+ * @param randomOrder True to order the vertices by a random permutation instead of by their numbers.
+ * @param passCount Optional output of the number of relaxation passes done.
+ * @return False if a negative-weight cycle is reachable from the start vertex, true otherwise.
+ */
+bool BellmanFord::AlgorithmCalculationFromListYen(slistEl** adjList, int numVertices, int startVertex, int* dist, int* prev,
+                                                  bool randomOrder, int* passCount) {
+    int* order = new int[numVertices];
+    int* rank = new int[numVertices];
+    for (int i = 0; i < numVertices; i++) {
+        order[i] = i;
+    }
+    if (randomOrder) {
+        for (int i = numVertices - 1; i > 0; i--) {
+            swap(order[i], order[rand() % (i + 1)]);
+        }
+    }
+    for (int i = 0; i < numVertices; i++) {
+        rank[order[i]] = i;
+    }
+
+    // Forward and backward edges of every vertex, stored contiguously in the order the passes visit them
+    int* forwardStart = new int[numVertices + 1]();
+    int* backwardStart = new int[numVertices + 1]();
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            if (rank[p->v] > rank[u]) {
+                forwardStart[rank[u] + 1]++;
+            } else if (rank[p->v] < rank[u]) {
+                backwardStart[rank[u] + 1]++;
+            }
+        }
+    }
+    for (int i = 0; i < numVertices; i++) {
+        forwardStart[i + 1] += forwardStart[i];
+        backwardStart[i + 1] += backwardStart[i];
+    }
+    int numForward = forwardStart[numVertices];
+    int numBackward = backwardStart[numVertices];
+    int* forwardTarget = new int[numForward > 0 ? numForward : 1];
+    int* forwardWeight = new int[numForward > 0 ? numForward : 1];
+    int* backwardTarget = new int[numBackward > 0 ? numBackward : 1];
+    int* backwardWeight = new int[numBackward > 0 ? numBackward : 1];
+    int* forwardFill = new int[numVertices];
+    int* backwardFill = new int[numVertices];
+    for (int i = 0; i < numVertices; i++) {
+        forwardFill[i] = forwardStart[i];
+        backwardFill[i] = backwardStart[i];
+    }
+    bool selfLoopNegative = false;
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            int r = rank[u];
+            if (rank[p->v] > r) {
+                forwardTarget[forwardFill[r]] = p->v;
+                forwardWeight[forwardFill[r]++] = p->weight;
+            } else if (rank[p->v] < r) {
+                backwardTarget[backwardFill[r]] = p->v;
+                backwardWeight[backwardFill[r]++] = p->weight;
+            } else if (p->weight < 0) {
+                selfLoopNegative = true;
+            }
+        }
+    }
+    delete[] forwardFill;
+    delete[] backwardFill;
+
+    for (int i = 0; i < numVertices; i++) {
+        dist[i] = INT_MAX;
+        prev[i] = -1;
+    }
+    dist[startVertex] = 0;
+    int passes = 0;
+
+    bool converged = false;
+    for (int pass = 1; pass <= numVertices && !converged; pass++) {
+        bool updated = false;
+        passes++;
+        for (int r = 0; r < numVertices; r++) {
+            int u = order[r];
+            if (dist[u] == INT_MAX) continue;
+            for (int e = forwardStart[r]; e < forwardStart[r + 1]; e++) {
+                int v = forwardTarget[e];
+                if (dist[u] + forwardWeight[e] < dist[v]) {
+                    dist[v] = dist[u] + forwardWeight[e];
+                    prev[v] = u;
+                    updated = true;
+                }
+            }
+        }
+        for (int r = numVertices - 1; r >= 0; r--) {
+            int u = order[r];
+            if (dist[u] == INT_MAX) continue;
+            for (int e = backwardStart[r]; e < backwardStart[r + 1]; e++) {
+                int v = backwardTarget[e];
+                if (dist[u] + backwardWeight[e] < dist[v]) {
+                    dist[v] = dist[u] + backwardWeight[e];
+                    prev[v] = u;
+                    updated = true;
+                }
+            }
+        }
+        converged = !updated;
+    }
+
+    // A negative self-loop on a reachable vertex is a negative cycle the passes never relax
+    if (converged && selfLoopNegative) {
+        for (int u = 0; u < numVertices && converged; u++) {
+            if (dist[u] == INT_MAX) continue;
+            for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+                if (p->v == u && p->weight < 0) {
+                    converged = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    delete[] order;
+    delete[] rank;
+    delete[] forwardStart;
+    delete[] backwardStart;
+    delete[] forwardTarget;
+    delete[] forwardWeight;
+    delete[] backwardTarget;
+    delete[] backwardWeight;
+    if (passCount) *passCount = passes;
+    return converged;
+}
+
+/**
+ * @brief Executes the Bellman-Ford algorithm as streaming passes over a structure-of-arrays edge list.
+ *
+ * Each pass is one call of SimdKernels::RelaxEdges, which streams through the src, dst and weight arrays with
+ * gathers (and scatters on AVX-512). The passes stop as soon as one makes no update; one more pass after V-1
+ * updating passes detects a negative cycle.
+ *
+ * @param edges The edges of the graph, sorted by destination.
+ * @param startVertex The starting vertex for the algorithm.
+ * @param dist Output array of shortest distances.
+ * @param prev Output array of previous vertices.
+ * @param passCount Optional output of the number of relaxation passes done.
+ * @return False if a negative-weight cycle is reachable from the start vertex, true otherwise.
+ */
+bool BellmanFord::AlgorithmCalculationFromEdgeArrays(const EdgeArrays& edges, int startVertex, int* dist, int* prev,
+                                                     int* passCount) {
+    int numVertices = edges.numVertices;
+    for (int i = 0; i < numVertices; i++) {
+        dist[i] = INT_MAX;
+        prev[i] = -1;
+    }
+
+    dist[startVertex] = 0;
+    int passes = 0;
+
+    for (int i = 1; i <= numVertices - 1; i++) {
+        passes++;
+        if (!SimdKernels::RelaxEdges(edges.src, edges.dst, edges.weight, edges.numEdges, dist, prev)) {
+            if (passCount) *passCount = passes;
+            return true;
+        }
+    }
+    if (passCount) *passCount = passes;
+
+    return !SimdKernels::RelaxEdges(edges.src, edges.dst, edges.weight, edges.numEdges, dist, prev);
 }
 
 /**
@@ -168,6 +467,14 @@ void BellmanFord::PrintResults(int* dist, int* prev, int numVertices, int startV
  * @param startVertex The starting vertex for the algorithm.
  */
 void BellmanFord::TimeCounterMatrix(int** incMatrix, int numVertices, int numEdges, int startVertex) {
+    pair<int*, int*> cached = ResultCache::LookupShortestPaths(ResultCache::BELLMAN_FORD, ResultCache::MATRIX, startVertex);
+    if (cached.first != nullptr) {
+        cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+        PrintResults(cached.first, cached.second, numVertices, startVertex);
+        delete[] cached.first;
+        delete[] cached.second;
+        return;
+    }
     cout << "Give number of iterations: ";
     int iterations;
     float wholeTime = 0;
@@ -179,11 +486,19 @@ void BellmanFord::TimeCounterMatrix(int** incMatrix, int numVertices, int numEdg
         pair<int*, int*> results = BellmanFord::AlgorithmCalculationFromMatrix(incMatrix, numVertices, numEdges, startVertex);
         auto end = chrono::high_resolution_clock::now();
         chrono::duration<double> elapsed = end - start;
+        if (results.first == nullptr) {
+            cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
+            return;
+        }
         if (iterations == 1) {
             BellmanFord::PrintResults(results.first, results.second, numVertices, startVertex);
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            ResultCache::StoreShortestPaths(ResultCache::BELLMAN_FORD, ResultCache::MATRIX, startVertex,
+                                            results.first, results.second, numVertices);
+        }
         delete[] results.first;
         delete[] results.second;
     }
@@ -198,6 +513,14 @@ void BellmanFord::TimeCounterMatrix(int** incMatrix, int numVertices, int numEdg
  * @param startVertex The starting vertex for the algorithm.
  */
 void BellmanFord::TimeCounterList(slistEl** adjList, int numVertices, int startVertex) {
+    pair<int*, int*> cached = ResultCache::LookupShortestPaths(ResultCache::BELLMAN_FORD, ResultCache::LIST, startVertex);
+    if (cached.first != nullptr) {
+        cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+        PrintResults(cached.first, cached.second, numVertices, startVertex);
+        delete[] cached.first;
+        delete[] cached.second;
+        return;
+    }
     cout << "Give number of iterations: ";
     int iterations;
     float wholeTime = 0;
@@ -209,14 +532,325 @@ void BellmanFord::TimeCounterList(slistEl** adjList, int numVertices, int startV
         pair<int*, int*> results = BellmanFord::AlgorithmCalculationFromList(adjList, numVertices, startVertex);
         auto end = chrono::high_resolution_clock::now();
         chrono::duration<double> elapsed = end - start;
+        if (results.first == nullptr) {
+            cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
+            cout << "Cycle: ";
+            NegativeCycleDetector::PrintCycle(adjList, NegativeCycleDetector::FindCycle(adjList, numVertices, startVertex));
+            return;
+        }
         if (iterations == 1) {
             BellmanFord::PrintResults(results.first, results.second, numVertices, startVertex);
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            ResultCache::StoreShortestPaths(ResultCache::BELLMAN_FORD, ResultCache::LIST, startVertex,
+                                            results.first, results.second, numVertices);
+        }
         delete[] results.first;
         delete[] results.second;
     }
     avgTime = wholeTime / iterations * 1000;
     cout << "Average time: " << avgTime << " ms" << endl;
 }
+
+/**
+ * @brief Builds a copy of the graph with weights shifted by random vertex potentials.
+ *
+ * Every edge (u, v) gets the weight w + p(u) - p(v). The weight of any cycle is unchanged, so a graph with
+ * non-negative weights becomes one with negative edges but without negative cycles.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param maxPotential The largest potential assigned to a vertex.
+ * @return The reweighted copy; it has negative edges but no negative cycles.
+ */
+slistEl** BellmanFord::negativeWeightCopy(slistEl** adjList, int numVertices, int maxPotential) {
+    int* potential = new int[numVertices];
+    for (int i = 0; i < numVertices; i++) {
+        potential[i] = rand() % (maxPotential + 1);
+    }
+    slistEl** copy = new slistEl*[numVertices]();
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            copy[u] = new slistEl{p->v, p->weight + potential[u] - potential[p->v], copy[u]};
+        }
+    }
+    delete[] potential;
+    return copy;
+}
+
+/**
+ * @brief Compares the sweeping and the queue-based variant on the graph and on a negative-weight copy of it.
+ *
+ * Both variants run on the same input and their distances are checked against each other. The work is reported
+ * as the number of edge relaxations: passes (plus the final check) times edges for the sweeping variant, and the
+ * out-edges of all scanned vertices for the queue-based one.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param startVertex The starting vertex for the algorithm.
+ */
+void BellmanFord::CompareQueueAndSweep(slistEl** adjList, int numVertices, int startVertex) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (iterations <= 0) {
+        return;
+    }
+
+    long long numArcs = 0;
+    int maxWeight = 0;
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            numArcs++;
+            if (p->weight > maxWeight) maxWeight = p->weight;
+        }
+    }
+    slistEl** negative = negativeWeightCopy(adjList, numVertices, 2 * maxWeight);
+    slistEl** inputs[2] = {adjList, negative};
+    const char* names[2] = {"Original weights", "Negative weights (potential shift)"};
+
+    int* dist = new int[numVertices];
+    int* prev = new int[numVertices];
+    int* queueDist = new int[numVertices];
+    for (int k = 0; k < 2; k++) {
+        double sweepTime = 0, queueTime = 0;
+        long long sweepRelaxations = 0, queueRelaxations = 0;
+        bool sweepOk = true, queueOk = true;
+        int passCount = 0;
+        long long scanCount = 0;
+        for (int i = 0; i < iterations; i++) {
+            auto start = chrono::high_resolution_clock::now();
+            sweepOk = AlgorithmCalculationFromList(inputs[k], numVertices, startVertex, dist, prev, &passCount);
+            auto end = chrono::high_resolution_clock::now();
+            sweepTime += chrono::duration<double>(end - start).count();
+            sweepRelaxations = (long long) (passCount + 1) * numArcs;
+
+            start = chrono::high_resolution_clock::now();
+            queueOk = AlgorithmCalculationFromListQueue(inputs[k], numVertices, startVertex, queueDist, prev, &scanCount,
+                                                        &queueRelaxations);
+            end = chrono::high_resolution_clock::now();
+            queueTime += chrono::duration<double>(end - start).count();
+        }
+
+        int mismatches = 0;
+        for (int v = 0; v < numVertices && sweepOk && queueOk; v++) {
+            if (dist[v] != queueDist[v]) mismatches++;
+        }
+        cout << names[k] << ":" << endl;
+        if (!sweepOk || !queueOk) {
+            cout << "  Negative-weight cycle reported (sweep: " << (sweepOk ? "no" : "yes")
+                 << ", queue: " << (queueOk ? "no" : "yes") << ")" << endl;
+        }
+        cout << "  Sweep:  " << sweepTime / iterations * 1000 << " ms, " << passCount << " passes, "
+             << sweepRelaxations << " edge relaxations" << endl;
+        cout << "  Queue:  " << queueTime / iterations * 1000 << " ms, " << scanCount << " vertex scans, "
+             << queueRelaxations << " edge relaxations" << endl;
+        if (mismatches > 0) {
+            cout << "  Distance mismatches: " << mismatches << endl;
+        }
+    }
+
+    freeCopy(negative, numVertices);
+    delete[] dist;
+    delete[] prev;
+    delete[] queueDist;
+}
+
+/**
+ * @brief Compares the matrix, list and edge-array versions, the latter at every available SIMD level.
+ *
+ * The edge arrays are extracted from the incidence matrix once; that cost is reported separately, since it is
+ * paid once per graph rather than once per pass.
+ *
+ * @param incMatrix The incidence matrix representing the graph.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param numEdges The number of edges in the graph.
+ * @param startVertex The starting vertex for the algorithm.
+ */
+void BellmanFord::TimeCounterEdgeArrays(int** incMatrix, slistEl** adjList, int numVertices, int numEdges, int startVertex) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (iterations <= 0) {
+        return;
+    }
+
+    auto start = chrono::high_resolution_clock::now();
+    EdgeArrays edges(incMatrix, numVertices, numEdges);
+    auto end = chrono::high_resolution_clock::now();
+    cout << "Edge arrays built from the incidence matrix in "
+         << chrono::duration<double>(end - start).count() * 1000 << " ms (" << edges.numEdges << " edges)" << endl;
+
+    int* expected = new int[numVertices];
+    int* dist = new int[numVertices];
+    int* prev = new int[numVertices];
+    double wholeTime = 0;
+    for (int i = 0; i < iterations; i++) {
+        start = chrono::high_resolution_clock::now();
+        pair<int*, int*> results = AlgorithmCalculationFromMatrix(incMatrix, numVertices, numEdges, startVertex);
+        end = chrono::high_resolution_clock::now();
+        wholeTime += chrono::duration<double>(end - start).count();
+        if (results.first == nullptr) {
+            cout << "Graph contains a negative-weight cycle" << endl;
+            delete[] expected;
+            delete[] dist;
+            delete[] prev;
+            return;
+        }
+        for (int v = 0; v < numVertices; v++) {
+            expected[v] = results.first[v];
+        }
+        delete[] results.first;
+        delete[] results.second;
+    }
+    printf("%-24s %-12s\n", "Version", "Time [ms]");
+    printf("%-24s %-12.3f\n", "Incidence matrix", wholeTime / iterations * 1000);
+
+    wholeTime = 0;
+    for (int i = 0; i < iterations; i++) {
+        start = chrono::high_resolution_clock::now();
+        AlgorithmCalculationFromList(adjList, numVertices, startVertex, dist, prev);
+        end = chrono::high_resolution_clock::now();
+        wholeTime += chrono::duration<double>(end - start).count();
+    }
+    printf("%-24s %-12.3f\n", "Adjacency list", wholeTime / iterations * 1000);
+
+    SimdKernels::Level detected = SimdKernels::DetectedLevel();
+    for (int level = SimdKernels::SCALAR; level <= detected; level++) {
+        SimdKernels::ForceLevel((SimdKernels::Level) level);
+        wholeTime = 0;
+        int passCount = 0;
+        for (int i = 0; i < iterations; i++) {
+            start = chrono::high_resolution_clock::now();
+            AlgorithmCalculationFromEdgeArrays(edges, startVertex, dist, prev, &passCount);
+            end = chrono::high_resolution_clock::now();
+            wholeTime += chrono::duration<double>(end - start).count();
+        }
+        int mismatches = 0;
+        for (int v = 0; v < numVertices; v++) {
+            if (dist[v] != expected[v]) mismatches++;
+        }
+        string name = string("Edge arrays (") + SimdKernels::LevelName((SimdKernels::Level) level) + ")";
+        printf("%-24s %-12.3f %d passes", name.c_str(), wholeTime / iterations * 1000, passCount);
+        if (mismatches > 0) {
+            printf(", %d distance mismatches", mismatches);
+        }
+        printf("\n");
+    }
+    SimdKernels::ForceLevel(detected);
+
+    delete[] expected;
+    delete[] dist;
+    delete[] prev;
+}
+
+/**
+ * @brief Frees an adjacency list built by negativeWeightCopy.
+ * @param adjList The adjacency list to free.
+ * @param numVertices The number of vertices in the graph.
+ */
+void BellmanFord::freeCopy(slistEl** adjList, int numVertices) {
+    for (int i = 0; i < numVertices; i++) {
+        slistEl* p = adjList[i];
+        while (p) {
+            slistEl* r = p;
+            p = p->next;
+            delete r;
+        }
+    }
+    delete[] adjList;
+}
+
+/**
+ * @brief Compares the number of passes and the time of plain sweeps and Yen's fixed and random orderings.
+ *
+ * Every variant runs on the graph and on a copy reweighted with random vertex potentials, which has negative
+ * edges but no negative cycles. The distances of Yen's variants are checked against the plain sweeps.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param startVertex The starting vertex for the algorithm.
+ */
+void BellmanFord::CompareVertexOrderings(slistEl** adjList, int numVertices, int startVertex) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (iterations <= 0) {
+        return;
+    }
+
+    int maxWeight = 0;
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            if (p->weight > maxWeight) maxWeight = p->weight;
+        }
+    }
+    slistEl** negative = negativeWeightCopy(adjList, numVertices, 2 * maxWeight);
+    slistEl** inputs[2] = {adjList, negative};
+    const char* names[2] = {"Original weights", "Negative weights (potential shift)"};
+    const char* variants[3] = {"Plain sweeps", "Yen, fixed order", "Yen, random order"};
+
+    int* expected = new int[numVertices];
+    int* dist = new int[numVertices];
+    int* prev = new int[numVertices];
+    for (int k = 0; k < 2; k++) {
+        cout << names[k] << ":" << endl;
+        printf("  %-20s %-12s %-12s\n", "Variant", "Time [ms]", "Avg passes");
+        for (int variant = 0; variant < 3; variant++) {
+            double wholeTime = 0;
+            long long passes = 0;
+            bool ok = true;
+            for (int i = 0; i < iterations; i++) {
+                int passCount = 0;
+                auto start = chrono::high_resolution_clock::now();
+                if (variant == 0) {
+                    ok = AlgorithmCalculationFromList(inputs[k], numVertices, startVertex, dist, prev, &passCount);
+                } else {
+                    ok = AlgorithmCalculationFromListYen(inputs[k], numVertices, startVertex, dist, prev, variant == 2,
+                                                         &passCount);
+                }
+                auto end = chrono::high_resolution_clock::now();
+                wholeTime += chrono::duration<double>(end - start).count();
+                passes += passCount;
+            }
+            int mismatches = 0;
+            for (int v = 0; v < numVertices; v++) {
+                if (variant == 0) {
+                    expected[v] = dist[v];
+                } else if (dist[v] != expected[v]) {
+                    mismatches++;
+                }
+            }
+            printf("  %-20s %-12.3f %-12.1f", variants[variant], wholeTime / iterations * 1000, (double) passes / iterations);
+            if (!ok) {
+                printf(" negative-weight cycle");
+            } else if (mismatches > 0) {
+                printf(" %d distance mismatches", mismatches);
+            }
+            printf("\n");
+        }
+    }
+
+    freeCopy(negative, numVertices);
+    delete[] expected;
+    delete[] dist;
+    delete[] prev;
+}
@@ -9,6 +9,8 @@
 #include <utility>
 #include "../GraphsGenerating.h" // Ensure this path is correct and accessible
 
+class EdgeArrays;
+
 /**
  * @class BellmanFord
  * @brief Class implementing the Bellman-Ford algorithm for finding the shortest paths in a graph.
@@ -34,6 +36,59 @@ public:
      */
     static std::pair<int*, int*> AlgorithmCalculationFromList(slistEl** adjList, int numVertices, int startVertex);
 
+    /**
+     * @brief Executes the Bellman-Ford algorithm on an adjacency list using caller-owned buffers.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param startVertex The starting vertex for the algorithm.
+     * @param dist Output array of shortest distances.
+     * @param prev Output array of previous vertices.
+     * @param passCount Optional output of the number of relaxation passes done.
+     * @return False if a negative-weight cycle is reachable from the start vertex, true otherwise.
+     */
+    static bool AlgorithmCalculationFromList(slistEl** adjList, int numVertices, int startVertex, int* dist, int* prev,
+                                             int* passCount = nullptr);
+
+    /**
+     * @brief Executes the queue-based Bellman-Ford algorithm (SPFA) with the SLF and LLL heuristics.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param startVertex The starting vertex for the algorithm.
+     * @param dist Output array of shortest distances.
+     * @param prev Output array of previous vertices.
+     * @param scanCount Optional output of the number of vertex scans done.
+     * @param relaxationCount Optional output of the number of edges examined.
+     * @return False if a negative-weight cycle is reachable from the start vertex, true otherwise.
+     */
+    static bool AlgorithmCalculationFromListQueue(slistEl** adjList, int numVertices, int startVertex, int* dist, int* prev,
+                                                  long long* scanCount = nullptr, long long* relaxationCount = nullptr);
+
+    /**
+     * @brief Executes the Bellman-Ford algorithm with Yen's vertex ordering.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param startVertex The starting vertex for the algorithm.
+     * @param dist Output array of shortest distances.
+     * @param prev Output array of previous vertices.
+     * @param randomOrder True to order the vertices by a random permutation instead of by their numbers.
+     * @param passCount Optional output of the number of relaxation passes done.
+     * @return False if a negative-weight cycle is reachable from the start vertex, true otherwise.
+     */
+    static bool AlgorithmCalculationFromListYen(slistEl** adjList, int numVertices, int startVertex, int* dist, int* prev,
+                                                bool randomOrder, int* passCount = nullptr);
+
+    /**
+     * @brief Executes the Bellman-Ford algorithm as streaming passes over a structure-of-arrays edge list.
+     * @param edges The edges of the graph, sorted by destination.
+     * @param startVertex The starting vertex for the algorithm.
+     * @param dist Output array of shortest distances.
+     * @param prev Output array of previous vertices.
+     * @param passCount Optional output of the number of relaxation passes done.
+     * @return False if a negative-weight cycle is reachable from the start vertex, true otherwise.
+     */
+    static bool AlgorithmCalculationFromEdgeArrays(const EdgeArrays& edges, int startVertex, int* dist, int* prev,
+                                                   int* passCount = nullptr);
+
     /**
      * @brief Prints the results of the Bellman-Ford algorithm.
      * @param dist The array of shortest distances.
@@ -59,6 +114,49 @@ public:
      * @param startVertex The starting vertex for the algorithm.
      */
     static void TimeCounterList(slistEl** adjList, int numVertices, int startVertex);
+
+    /**
+     * @brief Compares the sweeping and the queue-based variant on the graph and on a negative-weight copy of it.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param startVertex The starting vertex for the algorithm.
+     */
+    static void CompareQueueAndSweep(slistEl** adjList, int numVertices, int startVertex);
+
+    /**
+     * @brief Compares the matrix, list and edge-array versions, the latter at every available SIMD level.
+     * @param incMatrix The incidence matrix representing the graph.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param numEdges The number of edges in the graph.
+     * @param startVertex The starting vertex for the algorithm.
+     */
+    static void TimeCounterEdgeArrays(int** incMatrix, slistEl** adjList, int numVertices, int numEdges, int startVertex);
+
+    /**
+     * @brief Compares the number of passes and the time of plain sweeps and Yen's fixed and random orderings.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param startVertex The starting vertex for the algorithm.
+     */
+    static void CompareVertexOrderings(slistEl** adjList, int numVertices, int startVertex);
+
+private:
+    /**
+     * @brief Builds a copy of the graph with weights shifted by random vertex potentials.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param maxPotential The largest potential assigned to a vertex.
+     * @return The reweighted copy; it has negative edges but no negative cycles.
+     */
+    static slistEl** negativeWeightCopy(slistEl** adjList, int numVertices, int maxPotential);
+
+    /**
+     * @brief Frees an adjacency list built by negativeWeightCopy.
+     * @param adjList The adjacency list to free.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void freeCopy(slistEl** adjList, int numVertices);
 };
 
 #endif // BELLMANFORD_H
\ No newline at end of file
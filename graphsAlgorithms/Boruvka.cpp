@@ -0,0 +1,270 @@
+/**
+ * @file Boruvka.cpp
+ * @brief This file contains the implementation of the Boruvka class.
+ */
+
+#include "Boruvka.h"
+#include "ConcurrentUnionFind.h"
+#include "EdgeListBuilder.h"
+#include "SSSPBatchRunner.h"
+#include "ThreadBarrier.h"
+#include <iostream>
+#include <cstdio>
+#include <cstdint>
+#include <chrono>
+#include <thread>
+
+using namespace std;
+
+Kruskal::Edge* Boruvka::mst = nullptr;
+int Boruvka::mstSize = 0;
+vector<double> Boruvka::lastRoundTimes;
+vector<int> Boruvka::lastRoundEdges;
+
+static const uint64_t NO_EDGE = UINT64_MAX;
+
+/**
+ * @brief Packs a weight and an edge index into one key ordered by weight, then by index.
+ * @param weight The weight of the edge.
+ * @param index The index of the edge.
+ * @return The packed key.
+ */
+static inline uint64_t packEdge(int weight, int index) {
+    return ((uint64_t) ((uint32_t) weight ^ 0x80000000u) << 32) | (uint32_t) index;
+}
+
+/**
+ * @brief Executes Boruvka's algorithm on a graph represented as an adjacency list.
+ *
+ * Every undirected edge is taken once (u < v), as in Kruskal's algorithm; the edges are collected in parallel
+ * by EdgeListBuilder with the same number of threads.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param numThreads The number of threads; 0 uses the hardware concurrency.
+ * @return The total weight of the minimum spanning tree.
+ */
+int Boruvka::AlgorithmCalculationFromList(slistEl **adjList, int numVertices, int numThreads) {
+    int edgeCount;
+    Kruskal::Edge* edges = EdgeListBuilder::FromList(adjList, numVertices, numThreads, &edgeCount);
+    int mstWeight = AlgorithmCalculationFromEdges(edges, edgeCount, numVertices, numThreads);
+    delete[] edges;
+    return mstWeight;
+}
+
+/**
+ * @brief Executes Boruvka's algorithm on a prepared edge array, e.g. one shared through EdgeListBuilder.
+ *
+ * The working edge list stores the component roots of both ends and the packed (weight, index) key; the original
+ * ends are only looked up for the edges that join the tree. All phases split their range evenly between
+ * persistent workers that meet at a barrier between phases.
+ *
+ * @param edges The undirected edges, each listed once; left unchanged.
+ * @param edgeCount The number of edges.
+ * @param numVertices The number of vertices in the graph.
+ * @param numThreads The number of threads; 0 uses the hardware concurrency.
+ * @return The total weight of the minimum spanning tree.
+ */
+int Boruvka::AlgorithmCalculationFromEdges(const Kruskal::Edge *edges, int edgeCount, int numVertices,
+                                           int numThreads) {
+    lastRoundTimes.clear();
+    lastRoundEdges.clear();
+
+    int numEdges = edgeCount;
+    int* src = new int[numEdges > 0 ? numEdges : 1];
+    int* dst = new int[numEdges > 0 ? numEdges : 1];
+    uint64_t* key = new uint64_t[numEdges > 0 ? numEdges : 1];
+    int* nextSrc = new int[numEdges > 0 ? numEdges : 1];
+    int* nextDst = new int[numEdges > 0 ? numEdges : 1];
+    uint64_t* nextKey = new uint64_t[numEdges > 0 ? numEdges : 1];
+    for (int e = 0; e < numEdges; e++) {
+        src[e] = edges[e].src;
+        dst[e] = edges[e].dest;
+        key[e] = packEdge(edges[e].weight, e);
+    }
+
+    ConcurrentUnionFind components(numVertices);
+    atomic<uint64_t>* best = new atomic<uint64_t>[numVertices > 0 ? numVertices : 1];
+
+    delete[] mst;
+    mst = new Kruskal::Edge[numVertices > 1 ? numVertices - 1 : 1];
+    atomic<int> treeSize(0);
+
+    int threads = SSSPBatchRunner::ResolveThreads(numThreads);
+    int* survivors = new int[threads + 1];
+    int alive = numEdges;
+    bool done = alive == 0;
+    ThreadBarrier barrier(threads);
+    auto roundStart = chrono::high_resolution_clock::now();
+
+    auto worker = [&](int id) {
+        int vertexLo = (int) ((long long) numVertices * id / threads);
+        int vertexHi = (int) ((long long) numVertices * (id + 1) / threads);
+        while (!done) {
+            int edgeLo = (int) ((long long) alive * id / threads);
+            int edgeHi = (int) ((long long) alive * (id + 1) / threads);
+
+            // Phase 1: lightest edge leaving every component
+            for (int v = vertexLo; v < vertexHi; v++) {
+                best[v].store(NO_EDGE, memory_order_relaxed);
+            }
+            barrier.Wait();
+            for (int i = edgeLo; i < edgeHi; i++) {
+                uint64_t k = key[i];
+                for (int end : {src[i], dst[i]}) {
+                    uint64_t current = best[end].load(memory_order_relaxed);
+                    while (k < current && !best[end].compare_exchange_weak(current, k, memory_order_relaxed)) {
+                    }
+                }
+            }
+            barrier.Wait();
+
+            // Phase 2: merge along the chosen edges; an edge chosen by both of its components joins once
+            for (int v = vertexLo; v < vertexHi; v++) {
+                uint64_t k = best[v].load(memory_order_relaxed);
+                if (k == NO_EDGE) continue;
+                int index = (int) (uint32_t) k;
+                if (components.Unite(edges[index].src, edges[index].dest)) {
+                    mst[treeSize.fetch_add(1)] = edges[index];
+                }
+            }
+            barrier.Wait();
+
+            // Phase 3: relabel to roots and count the edges that still join two components
+            int count = 0;
+            for (int i = edgeLo; i < edgeHi; i++) {
+                src[i] = components.Find(src[i]);
+                dst[i] = components.Find(dst[i]);
+                if (src[i] != dst[i]) count++;
+            }
+            survivors[id + 1] = count;
+            barrier.Wait();
+            if (id == 0) {
+                survivors[0] = 0;
+                for (int t = 0; t < threads; t++) {
+                    survivors[t + 1] += survivors[t];
+                }
+                auto now = chrono::high_resolution_clock::now();
+                lastRoundEdges.push_back(alive);
+                lastRoundTimes.push_back(chrono::duration<double>(now - roundStart).count());
+                roundStart = now;
+            }
+            barrier.Wait();
+
+            // Phase 4: compact the survivors into the other buffer
+            int out = survivors[id];
+            for (int i = edgeLo; i < edgeHi; i++) {
+                if (src[i] != dst[i]) {
+                    nextSrc[out] = src[i];
+                    nextDst[out] = dst[i];
+                    nextKey[out] = key[i];
+                    out++;
+                }
+            }
+            barrier.Wait();
+            if (id == 0) {
+                swap(src, nextSrc);
+                swap(dst, nextDst);
+                swap(key, nextKey);
+                alive = survivors[threads];
+                done = alive == 0;
+            }
+            barrier.Wait();
+        }
+    };
+
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++) {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for (thread &t : pool) {
+        t.join();
+    }
+
+    mstSize = treeSize.load();
+    int mstWeight = 0;
+    for (int i = 0; i < mstSize; i++) {
+        mstWeight += mst[i].weight;
+    }
+
+    delete[] src;
+    delete[] dst;
+    delete[] key;
+    delete[] nextSrc;
+    delete[] nextDst;
+    delete[] nextKey;
+    delete[] best;
+    delete[] survivors;
+    return mstWeight;
+}
+
+/**
+ * @brief Prints the results of Boruvka's algorithm.
+ * @param mstWeight The total weight of the minimum spanning tree.
+ * @param elapsed The time taken by the algorithm, in milliseconds.
+ */
+void Boruvka::PrintResults(int mstWeight, double elapsed) {
+    printf("Minimum Spanning Tree Weight: %d\n", mstWeight);
+    printf("%-10s %-10s\n", "Edge", "Weight");
+    for (int i = 0; i < mstSize; ++i) {
+        printf("%-4d - %-4d \t%-4d\n", mst[i].src, mst[i].dest, mst[i].weight);
+    }
+    printf("Elapsed time: %.3f ms\n", elapsed);
+}
+
+/**
+ * @brief Measures the scaling over 1, 2, 4, ... threads, checks the weight against Kruskal and prints rounds.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+void Boruvka::TimeCounterList(slistEl **adjList, int numVertices) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Give the maximum number of threads (e.g. 64): ";
+    int maxThreads;
+    cin >> maxThreads;
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (maxThreads <= 0) maxThreads = 1;
+    if (iterations <= 0) iterations = 1;
+
+    auto start = chrono::high_resolution_clock::now();
+    int expected = Kruskal::AlgorithmCalculationFromList(adjList, numVertices);
+    auto end = chrono::high_resolution_clock::now();
+    cout << "Kruskal (serial): " << chrono::duration<double>(end - start).count() * 1000 << " ms, weight "
+         << expected << endl;
+
+    printf("%-10s %-12s %-10s %-8s\n", "Threads", "Time [ms]", "Speedup", "Rounds");
+    double baseTime = 0;
+    int mstWeight = 0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        double wholeTime = 0;
+        for (int i = 0; i < iterations; i++) {
+            start = chrono::high_resolution_clock::now();
+            mstWeight = AlgorithmCalculationFromList(adjList, numVertices, threads);
+            end = chrono::high_resolution_clock::now();
+            wholeTime += chrono::duration<double>(end - start).count();
+        }
+        double avgTime = wholeTime / iterations * 1000;
+        if (threads == 1) baseTime = avgTime;
+        printf("%-10d %-12.3f %-10.2f %-8d\n", threads, avgTime, baseTime / avgTime, (int) lastRoundTimes.size());
+        if (mstWeight != expected) {
+            cout << "Weight differs from Kruskal: " << mstWeight << endl;
+        }
+        if (threads * 2 > maxThreads) break;
+    }
+
+    cout << "Per-round times of the last run:" << endl;
+    printf("%-8s %-12s %-10s\n", "Round", "Edges", "Time [ms]");
+    for (size_t r = 0; r < lastRoundTimes.size(); r++) {
+        printf("%-8d %-12d %-10.4f\n", (int) r + 1, lastRoundEdges[r], lastRoundTimes[r] * 1000);
+    }
+    if (mstSize < numVertices - 1) {
+        cout << "The graph is disconnected; the result is a spanning forest with " << mstSize << " edges" << endl;
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ * @file Boruvka.h
+ * @brief This file contains the declaration of the Boruvka class.
+ */
+
+#ifndef BORUVKA_H
+#define BORUVKA_H
+
+#include <atomic>
+#include <vector>
+#include "../GraphsGenerating.h"
+#include "Kruskal.h"
+
+/**
+ * @class Boruvka
+ * @brief Class implementing a multi-threaded Boruvka algorithm for finding the minimum spanning tree in a graph.
+ *
+ * Every round has three parallel steps: all threads scan their range of the edge list and publish the lightest
+ * edge leaving each component with an atomic fetch-min; the chosen edges are merged with a ConcurrentUnionFind;
+ * and the edge list is compacted, dropping edges that now lie inside one component and relabelling the rest to
+ * component roots. Ties are broken by edge index, so the chosen edges never close a cycle and the result matches
+ * Kruskal's algorithm in weight. Each round at least halves the number of components.
+ */
+class Boruvka {
+public:
+    static Kruskal::Edge* mst; ///< The resulting MST (a spanning forest on disconnected graphs)
+    static int mstSize; ///< The number of edges in mst
+
+    /**
+     * @brief Executes Boruvka's algorithm on a graph represented as an adjacency list.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param numThreads The number of threads; 0 uses the hardware concurrency.
+     * @return The total weight of the minimum spanning tree.
+     */
+    static int AlgorithmCalculationFromList(slistEl **adjList, int numVertices, int numThreads);
+
+    /**
+     * @brief Executes Boruvka's algorithm on a prepared edge array, e.g. one shared through EdgeListBuilder.
+     * @param edges The undirected edges, each listed once; left unchanged.
+     * @param edgeCount The number of edges.
+     * @param numVertices The number of vertices in the graph.
+     * @param numThreads The number of threads; 0 uses the hardware concurrency.
+     * @return The total weight of the minimum spanning tree.
+     */
+    static int AlgorithmCalculationFromEdges(const Kruskal::Edge *edges, int edgeCount, int numVertices,
+                                             int numThreads);
+
+    /**
+     * @brief Prints the results of Boruvka's algorithm.
+     * @param mstWeight The total weight of the minimum spanning tree.
+     * @param elapsed The time taken to execute the algorithm.
+     */
+    static void PrintResults(int mstWeight, double elapsed);
+
+    /**
+     * @brief Measures the scaling over 1, 2, 4, ... threads, checks the weight against Kruskal and prints rounds.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices);
+
+    static std::vector<double> lastRoundTimes; ///< Duration of every round of the last run, in seconds
+    static std::vector<int> lastRoundEdges; ///< Number of edges between components entering every round of the last run
+};
+
+#endif // BORUVKA_H
@@ -0,0 +1,413 @@
+/**
+ * @file ConcurrentUnionFind.cpp
+ * @brief This file contains the implementation of the ConcurrentUnionFind class.
+ */
+
+#include "ConcurrentUnionFind.h"
+#include "EdgeListBuilder.h"
+#include "SSSPBatchRunner.h"
+#include <iostream>
+#include <cstdio>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Creates numElements singleton sets.
+ * @param numElements The number of elements.
+ */
+ConcurrentUnionFind::ConcurrentUnionFind(int numElements) {
+    this->numElements = numElements;
+    parent = new atomic<int>[numElements > 0 ? numElements : 1];
+    Reset();
+}
+
+/**
+ * @brief Destructor for the ConcurrentUnionFind class.
+ */
+ConcurrentUnionFind::~ConcurrentUnionFind() {
+    delete[] parent;
+}
+
+/**
+ * @brief Returns the fixed linking priority of an element.
+ *
+ * A hash of the index instead of stored random numbers: no extra array, and the same element always gets the same
+ * priority, which every thread must agree on.
+ *
+ * @param x The element.
+ * @return A pseudo-random priority; ties are broken by the element index.
+ */
+uint32_t ConcurrentUnionFind::priority(int x) {
+    uint32_t h = (uint32_t) x;
+    h ^= h >> 16;
+    h *= 0x7feb352dU;
+    h ^= h >> 15;
+    h *= 0x846ca68bU;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * @brief Checks whether root a should be linked below root b.
+ * @param a The first root.
+ * @param b The second root.
+ * @return True if a has the lower (priority, index).
+ */
+bool ConcurrentUnionFind::linksBelow(int a, int b) {
+    uint32_t pa = priority(a), pb = priority(b);
+    return pa < pb || (pa == pb && a < b);
+}
+
+/**
+ * @brief Finds the representative of an element; safe to call concurrently with Find and Unite.
+ *
+ * Path splitting: each visited element is pointed at its grandparent with one compare-and-swap, and the walk
+ * continues from the old parent. A failed swap is not retried, since the parent only ever moves up the tree, so
+ * the number of steps is bounded by the length of the path.
+ *
+ * @param x The element.
+ * @return The root of the set containing x at some moment during the call.
+ */
+int ConcurrentUnionFind::Find(int x) {
+    while (true) {
+        int p = parent[x].load(memory_order_acquire);
+        if (p == x) return x;
+        int grandparent = parent[p].load(memory_order_acquire);
+        if (grandparent == p) return p;
+        parent[x].compare_exchange_weak(p, grandparent, memory_order_release, memory_order_relaxed);
+        x = p;
+    }
+}
+
+/**
+ * @brief Merges the sets of two elements; safe to call concurrently with Find and Unite.
+ *
+ * The root with the lower priority is linked below the other one only if it is still a root; otherwise another
+ * thread linked it first and both roots are looked up again.
+ *
+ * @param x The first element.
+ * @param y The second element.
+ * @return True if this call merged two different sets.
+ */
+bool ConcurrentUnionFind::Unite(int x, int y) {
+    while (true) {
+        x = Find(x);
+        y = Find(y);
+        if (x == y) return false;
+        if (linksBelow(y, x)) {
+            int t = x;
+            x = y;
+            y = t;
+        }
+        int expected = x;
+        if (parent[x].compare_exchange_strong(expected, y, memory_order_acq_rel, memory_order_acquire)) return true;
+    }
+}
+
+/**
+ * @brief Checks whether two elements are in the same set; safe to call concurrently with Find and Unite.
+ *
+ * Different roots only prove different sets if the first root is still a root after the second was found.
+ *
+ * @param x The first element.
+ * @param y The second element.
+ * @return True if the elements were in the same set at some moment during the call.
+ */
+bool ConcurrentUnionFind::SameSet(int x, int y) {
+    while (true) {
+        x = Find(x);
+        y = Find(y);
+        if (x == y) return true;
+        if (parent[x].load(memory_order_acquire) == x) return false;
+    }
+}
+
+/**
+ * @brief Merges the pairs (xs[i], ys[i]), splitting the batch between threads.
+ *
+ * Every thread takes a contiguous range of the batch. With one thread the sequential path is used, so a batch
+ * pays for the atomic operations only when it actually runs in parallel.
+ *
+ * @param xs The first elements of the pairs.
+ * @param ys The second elements of the pairs.
+ * @param count The number of pairs.
+ * @param numThreads The number of threads; 0 uses the hardware concurrency, 1 uses the sequential path.
+ * @param merged Optional output: merged[i] is set to true if pair i joined two sets.
+ * @return The number of pairs that joined two sets.
+ */
+int ConcurrentUnionFind::UniteBatch(const int *xs, const int *ys, int count, int numThreads, bool *merged) {
+    int threads = SSSPBatchRunner::ResolveThreads(numThreads);
+    if (threads == 1) {
+        int joined = 0;
+        for (int i = 0; i < count; i++) {
+            bool result = UniteSequential(xs[i], ys[i]);
+            if (merged != nullptr) merged[i] = result;
+            if (result) joined++;
+        }
+        return joined;
+    }
+
+    vector<int> joined(threads, 0);
+    auto worker = [&](int t) {
+        int lo = (int) ((long long) count * t / threads);
+        int hi = (int) ((long long) count * (t + 1) / threads);
+        int local = 0;
+        for (int i = lo; i < hi; i++) {
+            bool result = Unite(xs[i], ys[i]);
+            if (merged != nullptr) merged[i] = result;
+            if (result) local++;
+        }
+        joined[t] = local;
+    };
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++) {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for (thread &t : pool) {
+        t.join();
+    }
+    int total = 0;
+    for (int j : joined) {
+        total += j;
+    }
+    return total;
+}
+
+/**
+ * @brief Finds the representative of an element with path splitting; no other thread may use the structure.
+ *
+ * The same single pass as Find, with plain stores in place of the compare-and-swap.
+ *
+ * @param x The element.
+ * @return The root of the set containing x.
+ */
+int ConcurrentUnionFind::FindSequential(int x) {
+    while (true) {
+        int p = parent[x].load(memory_order_relaxed);
+        int grandparent = parent[p].load(memory_order_relaxed);
+        if (p == grandparent) return p;
+        parent[x].store(grandparent, memory_order_relaxed);
+        x = p;
+    }
+}
+
+/**
+ * @brief Merges the sets of two elements; no other thread may use the structure.
+ * @param x The first element.
+ * @param y The second element.
+ * @return True if the sets were different.
+ */
+bool ConcurrentUnionFind::UniteSequential(int x, int y) {
+    x = FindSequential(x);
+    y = FindSequential(y);
+    if (x == y) return false;
+    if (linksBelow(x, y)) {
+        parent[x].store(y, memory_order_relaxed);
+    } else {
+        parent[y].store(x, memory_order_relaxed);
+    }
+    return true;
+}
+
+/**
+ * @brief Counts the sets; no other thread may update the structure.
+ * @return The number of disjoint sets.
+ */
+int ConcurrentUnionFind::CountSets() const {
+    int sets = 0;
+    for (int x = 0; x < numElements; x++) {
+        if (parent[x].load(memory_order_relaxed) == x) sets++;
+    }
+    return sets;
+}
+
+/**
+ * @brief Turns every element back into a singleton set.
+ */
+void ConcurrentUnionFind::Reset() {
+    for (int x = 0; x < numElements; x++) {
+        parent[x].store(x, memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Lets many threads unite random pairs of a few elements and checks the result against a sequential run.
+ *
+ * The concurrent structure must form a forest (every walk to a root ends within numElements steps), report
+ * exactly as many merges as the sequential run, contain every united pair in one set and induce the same sets,
+ * i.e. its roots must map one-to-one onto the sequential roots.
+ *
+ * @param numElements The number of elements; small values give heavy contention.
+ * @param numPairs The number of pairs.
+ * @param numThreads The number of threads.
+ * @param seed The seed of the pairs.
+ * @return True if the concurrent result is a valid forest with the same sets as the sequential one.
+ */
+bool ConcurrentUnionFind::StressTest(int numElements, int numPairs, int numThreads, unsigned int seed) {
+    if (numElements <= 0 || numPairs <= 0) {
+        return true;
+    }
+    vector<int> xs(numPairs), ys(numPairs);
+    uint32_t state = seed != 0 ? seed : 1;
+    for (int i = 0; i < numPairs; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        xs[i] = (int) (state % (uint32_t) numElements);
+        ys[i] = (int) ((state >> 11) % (uint32_t) numElements);
+    }
+
+    ConcurrentUnionFind concurrent(numElements);
+    ConcurrentUnionFind sequential(numElements);
+    int concurrentMerges = concurrent.UniteBatch(xs.data(), ys.data(), numPairs, numThreads > 1 ? numThreads : 2);
+    int sequentialMerges = sequential.UniteBatch(xs.data(), ys.data(), numPairs, 1);
+    if (concurrentMerges != sequentialMerges || concurrentMerges != numElements - concurrent.CountSets()) {
+        return false;
+    }
+
+    for (int x = 0; x < numElements; x++) {
+        int steps = 0;
+        for (int v = x; concurrent.parent[v].load() != v; v = concurrent.parent[v].load()) {
+            if (++steps > numElements) return false;
+        }
+    }
+    for (int i = 0; i < numPairs; i++) {
+        if (!concurrent.SameSet(xs[i], ys[i])) return false;
+    }
+    vector<int> image(numElements, -1);
+    for (int x = 0; x < numElements; x++) {
+        int root = concurrent.Find(x);
+        int expected = sequential.FindSequential(x);
+        if (image[root] == -1) {
+            image[root] = expected;
+        } else if (image[root] != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Compares the concurrent structure with Kruskal's arrays on the edges of a graph and runs a stress test.
+ *
+ * All variants unite the endpoints of every edge in the order of the adjacency list, as a spanning forest
+ * computation would; the number of merges must be the same everywhere. The stress tests then run twice as many
+ * threads as the benchmark on 16 and 1024 elements.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+void ConcurrentUnionFind::TimeCounterList(slistEl **adjList, int numVertices) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Give the maximum number of threads (e.g. 64): ";
+    int maxThreads;
+    cin >> maxThreads;
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (maxThreads <= 0) maxThreads = 1;
+    if (iterations <= 0) iterations = 1;
+
+    int edgeCount;
+    Kruskal::Edge* edges = EdgeListBuilder::FromList(adjList, numVertices, 0, &edgeCount);
+    int* xs = new int[edgeCount > 0 ? edgeCount : 1];
+    int* ys = new int[edgeCount > 0 ? edgeCount : 1];
+    for (int i = 0; i < edgeCount; i++) {
+        xs[i] = edges[i].src;
+        ys[i] = edges[i].dest;
+    }
+    delete[] edges;
+
+    cout << "Unite operations: " << edgeCount << endl;
+    printf("%-28s %-12s %-10s %-10s\n", "Variant", "Time [ms]", "Mops/s", "Merges");
+    auto report = [&](const char* name, double seconds, int merges) {
+        double avg = seconds / iterations;
+        printf("%-28s %-12.3f %-10.2f %-10d\n", name, avg * 1000, avg > 0 ? edgeCount / avg / 1e6 : 0.0, merges);
+    };
+
+    int* kruskalParent = new int[numVertices];
+    int* kruskalRank = new int[numVertices];
+    double elapsed = 0;
+    int merges = 0;
+    for (int it = 0; it < iterations; it++) {
+        for (int v = 0; v < numVertices; v++) {
+            kruskalParent[v] = v;
+            kruskalRank[v] = 0;
+        }
+        merges = 0;
+        auto start = chrono::high_resolution_clock::now();
+        for (int i = 0; i < edgeCount; i++) {
+            int x = Kruskal::find(kruskalParent, xs[i]);
+            int y = Kruskal::find(kruskalParent, ys[i]);
+            if (x != y) {
+                Kruskal::Union(kruskalParent, kruskalRank, x, y);
+                merges++;
+            }
+        }
+        elapsed += chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    }
+    report("Kruskal find/Union", elapsed, merges);
+    int expected = merges;
+    delete[] kruskalParent;
+    delete[] kruskalRank;
+
+    ConcurrentUnionFind unionFind(numVertices);
+    elapsed = 0;
+    for (int it = 0; it < iterations; it++) {
+        unionFind.Reset();
+        auto start = chrono::high_resolution_clock::now();
+        merges = unionFind.UniteBatch(xs, ys, edgeCount, 1);
+        elapsed += chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    }
+    report("Sequential path", elapsed, merges);
+
+    elapsed = 0;
+    for (int it = 0; it < iterations; it++) {
+        unionFind.Reset();
+        merges = 0;
+        auto start = chrono::high_resolution_clock::now();
+        for (int i = 0; i < edgeCount; i++) {
+            if (unionFind.Unite(xs[i], ys[i])) merges++;
+        }
+        elapsed += chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    }
+    report("Concurrent, 1 thread", elapsed, merges);
+    bool consistent = merges == expected;
+
+    for (int threads = 2; threads <= maxThreads; threads *= 2) {
+        elapsed = 0;
+        for (int it = 0; it < iterations; it++) {
+            unionFind.Reset();
+            auto start = chrono::high_resolution_clock::now();
+            merges = unionFind.UniteBatch(xs, ys, edgeCount, threads);
+            elapsed += chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+        }
+        char name[32];
+        snprintf(name, sizeof(name), "Concurrent, %d threads", threads);
+        report(name, elapsed, merges);
+        consistent = consistent && merges == expected;
+    }
+    if (!consistent) {
+        cout << "The number of merges differs between the variants" << endl;
+    }
+    delete[] xs;
+    delete[] ys;
+
+    int stressThreads = 2 * (maxThreads > 2 ? maxThreads : 2);
+    for (int elements : {16, 1024}) {
+        bool passed = true;
+        for (unsigned int seed = 1; seed <= 8 && passed; seed++) {
+            passed = StressTest(elements, 1 << 18, stressThreads, seed);
+        }
+        cout << "Stress test (" << elements << " elements, 8 x " << (1 << 18) << " pairs, " << stressThreads
+             << " threads): " << (passed ? "passed" : "FAILED") << endl;
+    }
+}
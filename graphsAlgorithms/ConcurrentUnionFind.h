@@ -0,0 +1,134 @@
+/**
+ * @file ConcurrentUnionFind.h
+ * @brief This file contains the declaration of the ConcurrentUnionFind class.
+ */
+
+#ifndef CONCURRENTUNIONFIND_H
+#define CONCURRENTUNIONFIND_H
+
+#include <atomic>
+#include <cstdint>
+#include "../GraphsGenerating.h"
+
+/**
+ * @class ConcurrentUnionFind
+ * @brief Class implementing a lock-free disjoint-set structure that many threads can update at once.
+ *
+ * Every element gets a fixed pseudo-random priority, and a union links the root with the lower priority below
+ * the other one with a single compare-and-swap, which keeps the trees shallow in expectation without a rank
+ * array. Find splits the path it walks (every visited element is pointed at its grandparent) and never waits for
+ * other threads: a failed compare-and-swap only means somebody else already shortened the path. Unite retries
+ * only when another thread linked one of its roots in the meantime. The *Sequential methods skip the atomic
+ * read-modify-write operations for single-threaded phases.
+ */
+class ConcurrentUnionFind {
+public:
+    /**
+     * @brief Creates numElements singleton sets.
+     * @param numElements The number of elements.
+     */
+    explicit ConcurrentUnionFind(int numElements);
+
+    /**
+     * @brief Destructor for the ConcurrentUnionFind class.
+     */
+    ~ConcurrentUnionFind();
+
+    ConcurrentUnionFind(const ConcurrentUnionFind &) = delete;
+    ConcurrentUnionFind &operator=(const ConcurrentUnionFind &) = delete;
+
+    /**
+     * @brief Finds the representative of an element; safe to call concurrently with Find and Unite.
+     * @param x The element.
+     * @return The root of the set containing x at some moment during the call.
+     */
+    int Find(int x);
+
+    /**
+     * @brief Merges the sets of two elements; safe to call concurrently with Find and Unite.
+     * @param x The first element.
+     * @param y The second element.
+     * @return True if this call merged two different sets.
+     */
+    bool Unite(int x, int y);
+
+    /**
+     * @brief Checks whether two elements are in the same set; safe to call concurrently with Find and Unite.
+     * @param x The first element.
+     * @param y The second element.
+     * @return True if the elements were in the same set at some moment during the call.
+     */
+    bool SameSet(int x, int y);
+
+    /**
+     * @brief Merges the pairs (xs[i], ys[i]), splitting the batch between threads.
+     * @param xs The first elements of the pairs.
+     * @param ys The second elements of the pairs.
+     * @param count The number of pairs.
+     * @param numThreads The number of threads; 0 uses the hardware concurrency, 1 uses the sequential path.
+     * @param merged Optional output: merged[i] is set to true if pair i joined two sets.
+     * @return The number of pairs that joined two sets.
+     */
+    int UniteBatch(const int *xs, const int *ys, int count, int numThreads, bool *merged = nullptr);
+
+    /**
+     * @brief Finds the representative of an element with path splitting; no other thread may use the structure.
+     * @param x The element.
+     * @return The root of the set containing x.
+     */
+    int FindSequential(int x);
+
+    /**
+     * @brief Merges the sets of two elements; no other thread may use the structure.
+     * @param x The first element.
+     * @param y The second element.
+     * @return True if the sets were different.
+     */
+    bool UniteSequential(int x, int y);
+
+    /**
+     * @brief Counts the sets; no other thread may update the structure.
+     * @return The number of disjoint sets.
+     */
+    int CountSets() const;
+
+    /**
+     * @brief Turns every element back into a singleton set.
+     */
+    void Reset();
+
+    /**
+     * @brief Compares the concurrent structure with Kruskal's arrays on the edges of a graph and runs a stress test.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Lets many threads unite random pairs of a few elements and checks the result against a sequential run.
+     * @param numElements The number of elements; small values give heavy contention.
+     * @param numPairs The number of pairs.
+     * @param numThreads The number of threads.
+     * @param seed The seed of the pairs.
+     * @return True if the concurrent result is a valid forest with the same sets as the sequential one.
+     */
+    static bool StressTest(int numElements, int numPairs, int numThreads, unsigned int seed);
+
+private:
+    /**
+     * @brief Returns the fixed linking priority of an element.
+     * @param x The element.
+     * @return A pseudo-random priority; ties are broken by the element index.
+     */
+    static uint32_t priority(int x);
+
+    /**
+     * @brief Checks whether root a should be linked below root b.
+     */
+    static bool linksBelow(int a, int b);
+
+    int numElements;
+    std::atomic<int> *parent;
+};
+
+#endif // CONCURRENTUNIONFIND_H
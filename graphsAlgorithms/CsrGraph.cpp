@@ -0,0 +1,54 @@
+/**
+ * @file CsrGraph.cpp
+ * @brief This file contains the implementation of the CsrGraph class.
+ */
+
+#include "CsrGraph.h"
+
+/**
+ * @brief Builds the CSR form of an adjacency list.
+ *
+ * Rows are filled by a counting pass followed by a placement pass, so building takes O(V + E).
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param transposed True to store the in-edges of every vertex instead of its out-edges.
+ */
+CsrGraph::CsrGraph(slistEl **adjList, int numVertices, bool transposed) {
+    this->numVertices = numVertices;
+    offsets = new int[numVertices + 1]();
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            offsets[(transposed ? p->v : u) + 1]++;
+        }
+    }
+    for (int u = 0; u < numVertices; u++) {
+        offsets[u + 1] += offsets[u];
+    }
+    numEdges = offsets[numVertices];
+    targets = new int[numEdges > 0 ? numEdges : 1];
+    weights = new int[numEdges > 0 ? numEdges : 1];
+
+    int* fill = new int[numVertices];
+    for (int u = 0; u < numVertices; u++) {
+        fill[u] = offsets[u];
+    }
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            int row = transposed ? p->v : u;
+            targets[fill[row]] = transposed ? u : p->v;
+            weights[fill[row]] = p->weight;
+            fill[row]++;
+        }
+    }
+    delete[] fill;
+}
+
+/**
+ * @brief Destructor for the CsrGraph class.
+ */
+CsrGraph::~CsrGraph() {
+    delete[] offsets;
+    delete[] targets;
+    delete[] weights;
+}
@@ -0,0 +1,44 @@
+/**
+ * @file CsrGraph.h
+ * @brief This file contains the declaration of the CsrGraph class.
+ */
+
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+
+#include "../GraphsGenerating.h"
+
+/**
+ * @class CsrGraph
+ * @brief Class storing a directed graph in compressed sparse row form.
+ *
+ * The out-edges of vertex u are targets[offsets[u]] .. targets[offsets[u + 1] - 1], with the matching weights.
+ * Contiguous arrays make edge ranges easy to split between threads and avoid the pointer chasing of the adjacency
+ * list. The transposed form stores in-edges instead, so targets then holds the tails of the edges.
+ */
+class CsrGraph {
+public:
+    /**
+     * @brief Builds the CSR form of an adjacency list.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param transposed True to store the in-edges of every vertex instead of its out-edges.
+     */
+    CsrGraph(slistEl **adjList, int numVertices, bool transposed = false);
+
+    /**
+     * @brief Destructor for the CsrGraph class.
+     */
+    ~CsrGraph();
+
+    CsrGraph(const CsrGraph &) = delete;
+    CsrGraph &operator=(const CsrGraph &) = delete;
+
+    int numVertices; ///< The number of vertices
+    int numEdges; ///< The number of directed edges
+    int *offsets; ///< numVertices + 1 row offsets into targets and weights
+    int *targets; ///< Edge heads (tails in the transposed form)
+    int *weights; ///< Edge weights
+};
+
+#endif // CSRGRAPH_H
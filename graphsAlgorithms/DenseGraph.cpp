@@ -0,0 +1,46 @@
+/**
+ * @file DenseGraph.cpp
+ * @brief This file contains the implementation of the DenseGraph class.
+ */
+
+#include "DenseGraph.h"
+#include <climits>
+#include <cstddef>
+
+/**
+ * @brief Builds the weight matrix of an adjacency list, keeping the lightest of parallel edges.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+DenseGraph::DenseGraph(slistEl **adjList, int numVertices) {
+    this->numVertices = numVertices;
+    size_t cells = (size_t) numVertices * numVertices;
+    weights = new int[cells > 0 ? cells : 1];
+    for (size_t i = 0; i < cells; i++) {
+        weights[i] = INT_MAX;
+    }
+    for (int u = 0; u < numVertices; u++) {
+        int* row = weights + (size_t) u * numVertices;
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            if (p->weight < row[p->v]) {
+                row[p->v] = p->weight;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Destructor for the DenseGraph class.
+ */
+DenseGraph::~DenseGraph() {
+    delete[] weights;
+}
+
+/**
+ * @brief Returns the weights of the edges leaving a vertex.
+ * @param u The vertex.
+ * @return numVertices weights, INT_MAX where there is no edge.
+ */
+const int *DenseGraph::Row(int u) const {
+    return weights + (size_t) u * numVertices;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file DenseGraph.h
+ * @brief This file contains the declaration of the DenseGraph class.
+ */
+
+#ifndef DENSEGRAPH_H
+#define DENSEGRAPH_H
+
+#include "../GraphsGenerating.h"
+
+/**
+ * @class DenseGraph
+ * @brief Class storing a graph as a row-contiguous V x V weight matrix.
+ *
+ * Row u holds the weight of the edge from u to every vertex, INT_MAX where there is no edge, so algorithms that
+ * touch every vertex per step (dense Prim) read each row as one sequential stream instead of chasing list nodes
+ * or scanning the columns of the incidence matrix.
+ */
+class DenseGraph {
+public:
+    /**
+     * @brief Builds the weight matrix of an adjacency list, keeping the lightest of parallel edges.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    DenseGraph(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Destructor for the DenseGraph class.
+     */
+    ~DenseGraph();
+
+    DenseGraph(const DenseGraph &) = delete;
+    DenseGraph &operator=(const DenseGraph &) = delete;
+
+    /**
+     * @brief Returns the weights of the edges leaving a vertex.
+     * @param u The vertex.
+     * @return numVertices weights, INT_MAX where there is no edge.
+     */
+    const int *Row(int u) const;
+
+    int numVertices; ///< The number of vertices
+    int *weights; ///< numVertices * numVertices weights, row by row
+};
+
+#endif // DENSEGRAPH_H
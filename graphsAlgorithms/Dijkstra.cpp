@@ -1,4 +1,7 @@
 #include "Dijkstra.h"
+#include "SimdKernels.h"
+#include "CsrGraph.h"
+#include "../ResultCache.h"
 #include <iostream>
 #include <climits>
 #include <chrono>
@@ -28,30 +31,33 @@ pair<int*, int*> Dijkstra::AlgorithmCalculationFromMatrix(int** incMatrix, int n
     PriorityQueue pq(numVertices, dist);
     pq.push(startVertex);
 
+    int* incident = new int[numEdges]; // Edges incident to the current vertex
+
     while (!pq.isEmpty()) {
         int u = pq.pop();
         visited[u] = true;
 
-        for (int e = 0; e < numEdges; e++) {
-            if (incMatrix[u][e] != 0) {
-                int v = -1;
-                int weight = abs(incMatrix[u][e]);
-                for (int i = 0; i < numVertices; i++) {
-                    if (i != u && incMatrix[i][e] != 0) {
-                        v = i;
-                        break;
-                    }
-                }
-                if (v != -1 && !visited[v] && dist[u] != INT_MAX && dist[u] + weight < dist[v]) {
-                    dist[v] = dist[u] + weight;
-                    prev[v] = u;
-                    pq.push(v);
+        int numIncident = SimdKernels::NonZeroPositions(incMatrix[u], numEdges, incident);
+        for (int k = 0; k < numIncident; k++) {
+            int e = incident[k];
+            int v = -1;
+            int weight = abs(incMatrix[u][e]);
+            for (int i = 0; i < numVertices; i++) {
+                if (i != u && incMatrix[i][e] != 0) {
+                    v = i;
+                    break;
                 }
             }
+            if (v != -1 && !visited[v] && dist[u] != INT_MAX && dist[u] + weight < dist[v]) {
+                dist[v] = dist[u] + weight;
+                prev[v] = u;
+                pq.push(v);
+            }
         }
     }
 
     delete[] visited;
+    delete[] incident;
 
     return make_pair(dist, prev);
 }
@@ -170,6 +176,16 @@ int PriorityQueue::pop() {
     return root;
 }
 
+/**
+ * @brief Empties the priority queue so it can be reused for another run over the same distance array.
+ */
+void PriorityQueue::clear() {
+    for (int i = 0; i < size; i++) {
+        pos[heap[i]] = -1;
+    }
+    size = 0;
+}
+
 /**
  * @brief Checks if the priority queue is empty.
  * @return True if the priority queue is empty, false otherwise.
@@ -190,14 +206,34 @@ pair<int*, int*> Dijkstra::AlgorithmCalculationFromList(slistEl** adjList, int n
     int* prev = new int[numVertices];
     bool* visited = new bool[numVertices];
 
+    PriorityQueue pq(numVertices, dist);
+    AlgorithmCalculationFromList(adjList, numVertices, startVertex, dist, prev, visited, pq);
+
+    delete[] visited;
+
+    return make_pair(dist, prev);
+}
+
+/**
+ * @brief Executes Dijkstra's algorithm on an adjacency list using caller-owned buffers.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param startVertex The starting vertex for the algorithm.
+ * @param dist Output array of shortest distances; it must be the array the priority queue was built over.
+ * @param prev Output array of previous vertices.
+ * @param visited Scratch array of numVertices flags.
+ * @param pq The priority queue to use; it is left empty on return.
+ */
+void Dijkstra::AlgorithmCalculationFromList(slistEl** adjList, int numVertices, int startVertex,
+                                            int* dist, int* prev, bool* visited, PriorityQueue& pq) {
     for (int i = 0; i < numVertices; i++) {
         dist[i] = INT_MAX;
         prev[i] = -1;
         visited[i] = false;
     }
 
+    pq.clear();
     dist[startVertex] = 0;
-    PriorityQueue pq(numVertices, dist);
     pq.push(startVertex);
 
     while (!pq.isEmpty()) {
@@ -215,10 +251,46 @@ pair<int*, int*> Dijkstra::AlgorithmCalculationFromList(slistEl** adjList, int n
             }
         }
     }
+}
 
-    delete[] visited;
+/**
+ * @brief Executes Dijkstra's algorithm on a CSR graph using caller-owned buffers.
+ *
+ * Same algorithm as the adjacency list overload; the edges of a vertex are read from contiguous arrays.
+ *
+ * @param graph The graph in CSR form; all weights must be non-negative.
+ * @param startVertex The starting vertex for the algorithm.
+ * @param dist Output array of shortest distances; it must be the array the priority queue was built over.
+ * @param prev Output array of previous vertices.
+ * @param visited Scratch array of numVertices flags.
+ * @param pq The priority queue to use; it is left empty on return.
+ */
+void Dijkstra::AlgorithmCalculationFromCsr(const CsrGraph& graph, int startVertex, int* dist, int* prev,
+                                           bool* visited, PriorityQueue& pq) {
+    int numVertices = graph.numVertices;
+    for (int i = 0; i < numVertices; i++) {
+        dist[i] = INT_MAX;
+        prev[i] = -1;
+        visited[i] = false;
+    }
 
-    return make_pair(dist, prev);
+    pq.clear();
+    dist[startVertex] = 0;
+    pq.push(startVertex);
+
+    while (!pq.isEmpty()) {
+        int u = pq.pop();
+        visited[u] = true;
+
+        for (int e = graph.offsets[u]; e < graph.offsets[u + 1]; e++) {
+            int v = graph.targets[e];
+            if (!visited[v] && dist[u] + graph.weights[e] < dist[v]) {
+                dist[v] = dist[u] + graph.weights[e];
+                prev[v] = u;
+                pq.push(v);
+            }
+        }
+    }
 }
 
 /**
@@ -252,6 +324,14 @@ void Dijkstra::PrintResults(int* dist, int* prev, int numVertices, int startVert
  * @param startVertex The starting vertex for the algorithm.
  */
 void Dijkstra::TimeCounterList(slistEl **adjList, int numVertices, int startVertex) {
+    pair<int*, int*> cached = ResultCache::LookupShortestPaths(ResultCache::DIJKSTRA, ResultCache::LIST, startVertex);
+    if (cached.first != nullptr) {
+        cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+        PrintResults(cached.first, cached.second, numVertices, startVertex);
+        delete[] cached.first;
+        delete[] cached.second;
+        return;
+    }
     cout << "Give number of iterations: ";
     int iterations;
     float wholeTime = 0;
@@ -268,6 +348,10 @@ void Dijkstra::TimeCounterList(slistEl **adjList, int numVertices, int startVert
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            ResultCache::StoreShortestPaths(ResultCache::DIJKSTRA, ResultCache::LIST, startVertex,
+                                            results.first, results.second, numVertices);
+        }
         delete[] results.first;
         delete[] results.second;
     }
@@ -283,6 +367,14 @@ void Dijkstra::TimeCounterList(slistEl **adjList, int numVertices, int startVert
  * @param startVertex The starting vertex for the algorithm.
  */
 void Dijkstra::TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges, int startVertex) {
+    pair<int*, int*> cached = ResultCache::LookupShortestPaths(ResultCache::DIJKSTRA, ResultCache::MATRIX, startVertex);
+    if (cached.first != nullptr) {
+        cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+        PrintResults(cached.first, cached.second, numVertices, startVertex);
+        delete[] cached.first;
+        delete[] cached.second;
+        return;
+    }
     cout << "Give number of iterations: ";
     int iterations;
     float wholeTime = 0;
@@ -299,6 +391,10 @@ void Dijkstra::TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges,
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            ResultCache::StoreShortestPaths(ResultCache::DIJKSTRA, ResultCache::MATRIX, startVertex,
+                                            results.first, results.second, numVertices);
+        }
         delete[] results.first;
         delete[] results.second;
     }
@@ -9,6 +9,8 @@
 #include <utility>
 #include "../GraphsGenerating.h" // Ensure this path is correct and accessible
 
+class CsrGraph;
+
 /**
  * @class PriorityQueue
  * @brief Class implementing a priority queue for use in Dijkstra's algorithm.
@@ -51,6 +53,11 @@ public:
      */
     void decreaseKey(int v);
 
+    /**
+     * @brief Empties the priority queue so it can be reused for another run over the same distance array.
+     */
+    void clear();
+
 private:
     void heapify(int idx);
     void swap(int* a, int* b);
@@ -86,6 +93,34 @@ public:
      */
     static std::pair<int*, int*> AlgorithmCalculationFromList(slistEl** adjList, int numVertices, int startVertex);
 
+    /**
+     * @brief Executes Dijkstra's algorithm on an adjacency list using caller-owned buffers.
+     *
+     * Nothing is allocated, so a worker running many sources can reuse the same buffers for every call.
+     *
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param startVertex The starting vertex for the algorithm.
+     * @param dist Output array of shortest distances; it must be the array the priority queue was built over.
+     * @param prev Output array of previous vertices.
+     * @param visited Scratch array of numVertices flags.
+     * @param pq The priority queue to use; it is left empty on return.
+     */
+    static void AlgorithmCalculationFromList(slistEl** adjList, int numVertices, int startVertex,
+                                             int* dist, int* prev, bool* visited, PriorityQueue& pq);
+
+    /**
+     * @brief Executes Dijkstra's algorithm on a CSR graph using caller-owned buffers.
+     * @param graph The graph in CSR form; all weights must be non-negative.
+     * @param startVertex The starting vertex for the algorithm.
+     * @param dist Output array of shortest distances; it must be the array the priority queue was built over.
+     * @param prev Output array of previous vertices.
+     * @param visited Scratch array of numVertices flags.
+     * @param pq The priority queue to use; it is left empty on return.
+     */
+    static void AlgorithmCalculationFromCsr(const CsrGraph& graph, int startVertex, int* dist, int* prev,
+                                            bool* visited, PriorityQueue& pq);
+
     /**
      * @brief Prints the results of Dijkstra's algorithm.
      * @param dist The array of shortest distances.
@@ -0,0 +1,228 @@
+/**
+ * @file Dinic.cpp
+ * @brief This file contains the implementation of the Dinic class.
+ */
+
+#include "Dinic.h"
+#include "FlowNetwork.h"
+#include "FordFulkersonBFS.h"
+#include "../ResultCache.h"
+#include <iostream>
+#include <climits>
+#include <chrono>
+
+using namespace std;
+
+int Dinic::lastPhases = 0;
+long long Dinic::lastAugmentations = 0;
+
+/**
+ * @brief Builds the level graph by a BFS from the source over arcs with residual capacity.
+ *
+ * The search stops expanding once it reaches the level of the sink, since no shortest augmenting path goes deeper.
+ *
+ * @param network The residual network.
+ * @param source The source vertex.
+ * @param sink The sink vertex.
+ * @param level Output: the BFS level of every vertex, -1 if unreached.
+ * @param queue Scratch array of numVertices entries.
+ * @return True if the sink is reachable.
+ */
+bool Dinic::buildLevels(const FlowNetwork &network, int source, int sink, int *level, int *queue) {
+    for (int v = 0; v < network.numVertices; v++) {
+        level[v] = -1;
+    }
+    int front = 0, back = 0;
+    queue[back++] = source;
+    level[source] = 0;
+    while (front != back) {
+        int u = queue[front++];
+        if (level[sink] != -1 && level[u] >= level[sink]) break;
+        for (int a = network.offsets[u]; a < network.offsets[u + 1]; a++) {
+            int v = network.heads[a];
+            if (network.residual[a] > 0 && level[v] == -1) {
+                level[v] = level[u] + 1;
+                queue[back++] = v;
+            }
+        }
+    }
+    return level[sink] != -1;
+}
+
+/**
+ * @brief Executes Dinic's algorithm on a residual network, starting from zero flow.
+ *
+ * The blocking flow DFS is iterative: path holds the arcs from the source to the current vertex. Reaching the sink
+ * pushes the bottleneck along the path and retreats to the tail of the first saturated arc; a vertex without an
+ * admissible arc left is removed from the level graph and the search retreats one arc, advancing the current arc of
+ * the previous vertex.
+ *
+ * @param network The residual network; it holds the maximum flow afterwards.
+ * @param source The source vertex.
+ * @param sink The sink vertex.
+ * @return The maximum flow from source to sink.
+ */
+int Dinic::AlgorithmCalculation(FlowNetwork &network, int source, int sink) {
+    int numVertices = network.numVertices;
+    network.Reset();
+    lastPhases = 0;
+    lastAugmentations = 0;
+    if (source == sink || numVertices <= 0) {
+        return 0;
+    }
+
+    int* level = new int[numVertices];
+    int* queue = new int[numVertices];
+    int* currentArc = new int[numVertices];
+    int* path = new int[numVertices];
+    int maxFlow = 0;
+
+    while (buildLevels(network, source, sink, level, queue)) {
+        lastPhases++;
+        for (int v = 0; v < numVertices; v++) {
+            currentArc[v] = network.offsets[v];
+        }
+        int pathLength = 0;
+        int u = source;
+        while (true) {
+            if (u == sink) {
+                int pathFlow = INT_MAX;
+                for (int i = 0; i < pathLength; i++) {
+                    pathFlow = min(pathFlow, network.residual[path[i]]);
+                }
+                int firstSaturated = -1;
+                for (int i = 0; i < pathLength; i++) {
+                    network.residual[path[i]] -= pathFlow;
+                    network.residual[network.mates[path[i]]] += pathFlow;
+                    if (firstSaturated == -1 && network.residual[path[i]] == 0) {
+                        firstSaturated = i;
+                    }
+                }
+                maxFlow += pathFlow;
+                lastAugmentations++;
+                pathLength = firstSaturated;
+                u = network.heads[network.mates[path[pathLength]]];
+                continue;
+            }
+
+            int end = network.offsets[u + 1];
+            int &a = currentArc[u];
+            while (a < end && (network.residual[a] == 0 || level[network.heads[a]] != level[u] + 1)) {
+                a++;
+            }
+            if (a < end) {
+                path[pathLength++] = a;
+                u = network.heads[a];
+            } else {
+                level[u] = -1;
+                if (u == source) break;
+                pathLength--;
+                u = network.heads[network.mates[path[pathLength]]];
+                currentArc[u]++;
+            }
+        }
+    }
+
+    delete[] level;
+    delete[] queue;
+    delete[] currentArc;
+    delete[] path;
+    return maxFlow;
+}
+
+/**
+ * @brief Executes Dinic's algorithm on a graph represented as an adjacency list.
+ * @param graph The adjacency list representing the graph.
+ * @param source The source vertex.
+ * @param sink The sink vertex.
+ * @param numVertices The number of vertices in the graph.
+ * @return The maximum flow from source to sink.
+ */
+int Dinic::AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices) {
+    FlowNetwork network(graph, numVertices);
+    return AlgorithmCalculation(network, source, sink);
+}
+
+/**
+ * @brief Measures and prints the time taken by Dinic's algorithm on a graph represented as an adjacency list.
+ *
+ * The residual network is built once and reset before every iteration, so the iteration times cover the
+ * algorithm alone. The minimum cut of the last run is stored in the result cache.
+ *
+ * @param graph The adjacency list representing the graph.
+ * @param source The source vertex.
+ * @param sink The sink vertex.
+ * @param numVertices The number of vertices in the graph.
+ */
+void Dinic::TimeCounterList(slistEl **graph, int source, int sink, int numVertices) {
+    int cachedFlow;
+    const bool* cachedCut;
+    if (ResultCache::LookupMaxFlow(ResultCache::DINIC, ResultCache::LIST, source, sink, &cachedFlow, &cachedCut)) {
+        cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+        printf("Max Flow: %d\n", cachedFlow);
+        return;
+    }
+    cout << "Give number of iterations: ";
+    int iterations;
+    float wholeTime = 0;
+    float avgTime;
+    cin >> iterations;
+    cout << endl;
+
+    auto start = chrono::high_resolution_clock::now();
+    FlowNetwork network(graph, numVertices);
+    auto end = chrono::high_resolution_clock::now();
+    chrono::duration<double> buildTime = end - start;
+    cout << "Building the residual network (" << network.numArcs << " arcs): " << buildTime.count() * 1000 << " ms" << endl;
+
+    int maxFlow = 0;
+    for (int i = 0; i < iterations; i++) {
+        start = chrono::high_resolution_clock::now();
+        maxFlow = AlgorithmCalculation(network, source, sink);
+        end = chrono::high_resolution_clock::now();
+        chrono::duration<double> elapsed = end - start;
+        cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
+        wholeTime += elapsed.count();
+    }
+    if (iterations <= 0) {
+        return;
+    }
+
+    bool* sourceSide = new bool[numVertices];
+    int cutSize = network.SourceSide(source, sourceSide);
+    ResultCache::StoreMaxFlow(ResultCache::DINIC, ResultCache::LIST, source, sink, maxFlow, sourceSide, numVertices);
+    delete[] sourceSide;
+
+    printf("Phases: %d, augmenting paths: %lld\n", lastPhases, lastAugmentations);
+    printf("Source side of the minimum cut: %d vertices\n", cutSize);
+    printf("Max Flow: %d\n", maxFlow);
+    avgTime = wholeTime / iterations * 1000;
+    cout << "Average time: " << avgTime << " ms" << endl;
+}
+
+/**
+ * @brief Compares Dinic's algorithm with the BFS Ford-Fulkerson algorithm on the same graph.
+ * @param graph The adjacency list representing the graph.
+ * @param source The source vertex.
+ * @param sink The sink vertex.
+ * @param numVertices The number of vertices in the graph.
+ * @return True if both algorithms returned the same maximum flow value.
+ */
+bool Dinic::CompareWithFordFulkerson(slistEl **graph, int source, int sink, int numVertices) {
+    auto start = chrono::high_resolution_clock::now();
+    int dinicFlow = AlgorithmCalculationFromList(graph, source, sink, numVertices);
+    auto end = chrono::high_resolution_clock::now();
+    chrono::duration<double> dinicTime = end - start;
+
+    start = chrono::high_resolution_clock::now();
+    int fordFulkersonFlow = FordFulkersonBFS::AlgorithmCalculationFromList(graph, source, sink, numVertices);
+    end = chrono::high_resolution_clock::now();
+    chrono::duration<double> fordFulkersonTime = end - start;
+
+    printf("Dinic:                  %10.3f ms, max flow %d (%d phases, %lld augmenting paths)\n",
+           dinicTime.count() * 1000, dinicFlow, lastPhases, lastAugmentations);
+    printf("Ford-Fulkerson (BFS):   %10.3f ms, max flow %d\n", fordFulkersonTime.count() * 1000, fordFulkersonFlow);
+    bool equal = dinicFlow == fordFulkersonFlow;
+    printf("Max flow values: %d and %d (%s)\n", dinicFlow, fordFulkersonFlow, equal ? "equal" : "different");
+    return equal;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file Dinic.h
+ * @brief This file contains the declaration of the Dinic class.
+ */
+
+#ifndef DINIC_H
+#define DINIC_H
+
+#include "../GraphsGenerating.h"
+
+class FlowNetwork;
+
+/**
+ * @class Dinic
+ * @brief Class implementing Dinic's blocking flow algorithm for finding the maximum flow in a graph.
+ *
+ * Every phase runs one BFS from the source over the residual network to build the level graph, then pushes a
+ * blocking flow along level-increasing arcs with an iterative DFS. The DFS keeps a current-arc pointer per vertex,
+ * so an arc that is saturated or leads to a dead end is never scanned again in the same phase. The number of phases
+ * is at most V - 1, and on unit-capacity networks it is O(sqrt(E)).
+ */
+class Dinic {
+public:
+    static int lastPhases; ///< Number of phases (level graphs) in the last run
+    static long long lastAugmentations; ///< Number of augmenting paths pushed in the last run
+
+    /**
+     * @brief Executes Dinic's algorithm on a residual network, starting from zero flow.
+     * @param network The residual network; it holds the maximum flow afterwards.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @return The maximum flow from source to sink.
+     */
+    static int AlgorithmCalculation(FlowNetwork &network, int source, int sink);
+
+    /**
+     * @brief Executes Dinic's algorithm on a graph represented as an adjacency list.
+     * @param graph The adjacency list representing the graph.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param numVertices The number of vertices in the graph.
+     * @return The maximum flow from source to sink.
+     */
+    static int AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices);
+
+    /**
+     * @brief Measures and prints the time taken by Dinic's algorithm on a graph represented as an adjacency list.
+     * @param graph The adjacency list representing the graph.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void TimeCounterList(slistEl **graph, int source, int sink, int numVertices);
+
+    /**
+     * @brief Compares Dinic's algorithm with the BFS Ford-Fulkerson algorithm on the same graph.
+     * @param graph The adjacency list representing the graph.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param numVertices The number of vertices in the graph.
+     * @return True if both algorithms returned the same maximum flow value.
+     */
+    static bool CompareWithFordFulkerson(slistEl **graph, int source, int sink, int numVertices);
+
+private:
+    /**
+     * @brief Builds the level graph by a BFS from the source over arcs with residual capacity.
+     * @param network The residual network.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param level Output: the BFS level of every vertex, -1 if unreached.
+     * @param queue Scratch array of numVertices entries.
+     * @return True if the sink is reachable.
+     */
+    static bool buildLevels(const FlowNetwork &network, int source, int sink, int *level, int *queue);
+};
+
+#endif // DINIC_H
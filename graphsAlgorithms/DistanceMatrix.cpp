@@ -0,0 +1,260 @@
+/**
+ * @file DistanceMatrix.cpp
+ * @brief This file contains the implementation of the DistanceMatrix class.
+ */
+
+#include "DistanceMatrix.h"
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define DISTANCE_MATRIX_MMAP 1
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#define DISTANCE_MATRIX_MMAP 0
+#endif
+
+using namespace std;
+
+/**
+ * @brief Moves the position of a spill file to a byte offset.
+ *
+ * A spilled matrix is larger than 2 GB long before it is too big for memory, and long is 32 bits on Windows,
+ * so the 64-bit seek of each platform is used instead of fseek.
+ *
+ * @param file The spill file.
+ * @param offset The byte offset from the start of the file.
+ * @return True if the position was moved.
+ */
+static bool seekTo(FILE* file, unsigned long long offset) {
+#if defined(_WIN32)
+    return _fseeki64(file, (__int64) offset, SEEK_SET) == 0;
+#else
+    return fseeko(file, (off_t) offset, SEEK_SET) == 0;
+#endif
+}
+
+/**
+ * @brief Creates a matrix of zeros.
+ *
+ * A spill file is sized up front; on POSIX it is mapped shared, so written tiles can be flushed to disk by the
+ * operating system instead of occupying memory. If the file cannot be created the matrix stays in memory.
+ *
+ * @param numVertices The number of rows and columns.
+ * @param spillPath Path of the file to spill to, or nullptr to keep the matrix in memory.
+ */
+DistanceMatrix::DistanceMatrix(int numVertices, const char *spillPath) {
+    this->numVertices = numVertices;
+    numBlocks = (numVertices + BLOCK - 1) / BLOCK;
+    bytes = (unsigned long long) numBlocks * numBlocks * BLOCK * BLOCK * sizeof(int);
+    data = nullptr;
+    file = nullptr;
+    descriptor = -1;
+
+    if (spillPath != nullptr) {
+        path = spillPath;
+#if DISTANCE_MATRIX_MMAP
+        descriptor = open(spillPath, O_RDWR | O_CREAT | O_TRUNC, 0600);
+        if (descriptor != -1 && ftruncate(descriptor, (off_t) bytes) == 0) {
+            void* mapped = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+            if (mapped != MAP_FAILED) {
+                data = (int*) mapped;
+                return;
+            }
+        }
+        if (descriptor != -1) {
+            close(descriptor);
+            descriptor = -1;
+        }
+#else
+        file = fopen(spillPath, "w+b");
+        if (file != nullptr && seekTo(file, bytes - 1) && fputc(0, file) != EOF) {
+            return;
+        }
+        if (file != nullptr) {
+            fclose(file);
+            file = nullptr;
+        }
+#endif
+        remove(spillPath);
+        path.clear();
+        cout << "Could not create the spill file, keeping the matrix in memory" << endl;
+    }
+    data = new int[bytes / sizeof(int)]();
+}
+
+/**
+ * @brief Destructor for the DistanceMatrix class; a spill file is removed.
+ */
+DistanceMatrix::~DistanceMatrix() {
+#if DISTANCE_MATRIX_MMAP
+    if (descriptor != -1) {
+        munmap(data, bytes);
+        close(descriptor);
+        data = nullptr;
+    }
+#endif
+    if (file != nullptr) {
+        fclose(file);
+    }
+    if (!path.empty()) {
+        remove(path.c_str());
+    }
+    delete[] data;
+}
+
+/**
+ * @brief Returns the position of an entry in the tiled layout.
+ * @param u The row.
+ * @param v The column.
+ * @return The index of the entry, in ints.
+ */
+unsigned long long DistanceMatrix::index(int u, int v) const {
+    unsigned long long tile = (unsigned long long) (u / BLOCK) * numBlocks + v / BLOCK;
+    return tile * BLOCK * BLOCK + (u % BLOCK) * BLOCK + v % BLOCK;
+}
+
+/**
+ * @brief Returns one entry.
+ * @param u The row.
+ * @param v The column.
+ * @return The stored value.
+ */
+int DistanceMatrix::Get(int u, int v) const {
+    if (data != nullptr) {
+        return data[index(u, v)];
+    }
+    int value = 0;
+    seekTo(file, index(u, v) * sizeof(int));
+    if (fread(&value, sizeof(int), 1, file) != 1) {
+        value = 0;
+    }
+    return value;
+}
+
+/**
+ * @brief Sets one entry.
+ * @param u The row.
+ * @param v The column.
+ * @param value The value to store.
+ */
+void DistanceMatrix::Set(int u, int v, int value) {
+    if (data != nullptr) {
+        data[index(u, v)] = value;
+        return;
+    }
+    seekTo(file, index(u, v) * sizeof(int));
+    fwrite(&value, sizeof(int), 1, file);
+}
+
+/**
+ * @brief Copies a whole row into the matrix.
+ *
+ * A row crosses one tile per block column; each crossing is a contiguous run of up to BLOCK entries.
+ *
+ * @param u The row.
+ * @param values numVertices values.
+ */
+void DistanceMatrix::SetRow(int u, const int *values) {
+    for (int b = 0; b < numBlocks; b++) {
+        int length = min(BLOCK, numVertices - b * BLOCK);
+        unsigned long long start = index(u, b * BLOCK);
+        if (data != nullptr) {
+            memcpy(data + start, values + b * BLOCK, length * sizeof(int));
+        } else {
+            seekTo(file, start * sizeof(int));
+            fwrite(values + b * BLOCK, sizeof(int), length, file);
+        }
+    }
+}
+
+/**
+ * @brief Copies a whole row out of the matrix.
+ * @param u The row.
+ * @param values Output array of numVertices values.
+ */
+void DistanceMatrix::GetRow(int u, int *values) const {
+    for (int b = 0; b < numBlocks; b++) {
+        int length = min(BLOCK, numVertices - b * BLOCK);
+        unsigned long long start = index(u, b * BLOCK);
+        if (data != nullptr) {
+            memcpy(values + b * BLOCK, data + start, length * sizeof(int));
+        } else {
+            seekTo(file, start * sizeof(int));
+            if (fread(values + b * BLOCK, sizeof(int), length, file) != (size_t) length) {
+                memset(values + b * BLOCK, 0, length * sizeof(int));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sets every entry (including the padding of the last tiles) to a value.
+ * @param value The value to store.
+ */
+void DistanceMatrix::Fill(int value) {
+    unsigned long long count = bytes / sizeof(int);
+    if (data != nullptr) {
+        for (unsigned long long i = 0; i < count; i++) {
+            data[i] = value;
+        }
+        return;
+    }
+    int* tile = new int[BLOCK * BLOCK];
+    for (int i = 0; i < BLOCK * BLOCK; i++) {
+        tile[i] = value;
+    }
+    seekTo(file, 0);
+    for (unsigned long long done = 0; done < count; done += BLOCK * BLOCK) {
+        fwrite(tile, sizeof(int), BLOCK * BLOCK, file);
+    }
+    delete[] tile;
+}
+
+/**
+ * @brief Returns a pointer to a tile, stored row by row.
+ * @param blockRow The tile row.
+ * @param blockCol The tile column.
+ * @return The tile, or nullptr if the matrix is accessed through stdio.
+ */
+int *DistanceMatrix::Tile(int blockRow, int blockCol) {
+    if (data == nullptr) {
+        return nullptr;
+    }
+    return data + ((unsigned long long) blockRow * numBlocks + blockCol) * BLOCK * BLOCK;
+}
+
+/**
+ * @brief Returns the number of rows and columns.
+ * @return The number of vertices.
+ */
+int DistanceMatrix::NumVertices() const {
+    return numVertices;
+}
+
+/**
+ * @brief Returns the number of tiles per row.
+ * @return The number of blocks.
+ */
+int DistanceMatrix::NumBlocks() const {
+    return numBlocks;
+}
+
+/**
+ * @brief Returns the storage size, including tile padding.
+ * @return The number of bytes.
+ */
+unsigned long long DistanceMatrix::Bytes() const {
+    return bytes;
+}
+
+/**
+ * @brief Checks whether the matrix lives in a file.
+ * @return True if the matrix was spilled.
+ */
+bool DistanceMatrix::IsSpilled() const {
+    return !path.empty();
+}
@@ -0,0 +1,123 @@
+/**
+ * @file DistanceMatrix.h
+ * @brief This file contains the declaration of the DistanceMatrix class.
+ */
+
+#ifndef DISTANCEMATRIX_H
+#define DISTANCEMATRIX_H
+
+#include <cstdio>
+#include <string>
+
+/**
+ * @class DistanceMatrix
+ * @brief Class storing a V x V matrix of int distances in square blocks, in memory or spilled to a file.
+ *
+ * The matrix is split into BLOCK x BLOCK tiles stored one after another, so a tile is contiguous and can be
+ * processed in cache. A spilled matrix lives in a temporary file that is memory-mapped on POSIX systems; there
+ * the operating system pages tiles in and out, so matrices larger than RAM (e.g. 10 GB for V = 50000) still
+ * work. Without mmap the file is accessed with stdio and tiles are not directly addressable.
+ */
+class DistanceMatrix {
+public:
+    static constexpr int BLOCK = 64; ///< Side of a tile, in entries
+
+    /**
+     * @brief Creates a matrix of zeros.
+     * @param numVertices The number of rows and columns.
+     * @param spillPath Path of the file to spill to, or nullptr to keep the matrix in memory.
+     */
+    explicit DistanceMatrix(int numVertices, const char *spillPath = nullptr);
+
+    /**
+     * @brief Destructor for the DistanceMatrix class; a spill file is removed.
+     */
+    ~DistanceMatrix();
+
+    DistanceMatrix(const DistanceMatrix &) = delete;
+    DistanceMatrix &operator=(const DistanceMatrix &) = delete;
+
+    /**
+     * @brief Returns one entry.
+     * @param u The row.
+     * @param v The column.
+     * @return The stored value.
+     */
+    int Get(int u, int v) const;
+
+    /**
+     * @brief Sets one entry.
+     * @param u The row.
+     * @param v The column.
+     * @param value The value to store.
+     */
+    void Set(int u, int v, int value);
+
+    /**
+     * @brief Copies a whole row into the matrix.
+     * @param u The row.
+     * @param values numVertices values.
+     */
+    void SetRow(int u, const int *values);
+
+    /**
+     * @brief Copies a whole row out of the matrix.
+     * @param u The row.
+     * @param values Output array of numVertices values.
+     */
+    void GetRow(int u, int *values) const;
+
+    /**
+     * @brief Sets every entry (including the padding of the last tiles) to a value.
+     * @param value The value to store.
+     */
+    void Fill(int value);
+
+    /**
+     * @brief Returns a pointer to a tile, stored row by row.
+     * @param blockRow The tile row.
+     * @param blockCol The tile column.
+     * @return The tile, or nullptr if the matrix is accessed through stdio.
+     */
+    int *Tile(int blockRow, int blockCol);
+
+    /**
+     * @brief Returns the number of rows and columns.
+     * @return The number of vertices.
+     */
+    int NumVertices() const;
+
+    /**
+     * @brief Returns the number of tiles per row.
+     * @return The number of blocks.
+     */
+    int NumBlocks() const;
+
+    /**
+     * @brief Returns the storage size, including tile padding.
+     * @return The number of bytes.
+     */
+    unsigned long long Bytes() const;
+
+    /**
+     * @brief Checks whether the matrix lives in a file.
+     * @return True if the matrix was spilled.
+     */
+    bool IsSpilled() const;
+
+private:
+    /**
+     * @brief Returns the position of an entry in the tiled layout.
+     */
+    unsigned long long index(int u, int v) const;
+
+    int numVertices;
+    int numBlocks;
+    unsigned long long bytes;
+    int *data; // In-memory or memory-mapped storage; nullptr with the stdio fallback
+    FILE *file; // Spill file of the stdio fallback
+    int descriptor; // Spill file of the mmap path, or -1
+    std::string path;
+};
+
+#endif // DISTANCEMATRIX_H
@@ -0,0 +1,672 @@
+/**
+ * @file DynamicMST.cpp
+ * @brief This file contains the implementation of the DynamicMST class.
+ */
+
+#include "DynamicMST.h"
+#include "ConcurrentUnionFind.h"
+#include "EdgeListBuilder.h"
+#include "EdgeSort.h"
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <climits>
+#include <chrono>
+#include <string>
+
+using namespace std;
+
+/**
+ * @brief Copies the edges of the graph and builds the initial forest with Kruskal's algorithm.
+ *
+ * The edges are sorted once and stored in that order; a union-find decides which of them join the forest, so
+ * only the tree edges are linked into the link-cut tree.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+DynamicMST::DynamicMST(slistEl **adjList, int numVertices) {
+    this->numVertices = numVertices;
+    stamp = 0;
+    totalWeight = 0;
+    for (int t = 0; t < 3; t++) {
+        for (int b = 0; b < LATENCY_BUCKETS; b++) {
+            latency[t][b] = 0;
+        }
+        maxLatency[t] = 0;
+    }
+    nodes.resize(numVertices);
+    for (int v = 0; v < numVertices; v++) {
+        nodes[v] = {{-1, -1}, -1, false, INT_MIN, v};
+    }
+    incident.resize(numVertices);
+    seen.assign(numVertices, 0);
+
+    int count;
+    Kruskal::Edge* initial = EdgeListBuilder::FromList(adjList, numVertices, 0, &count);
+    EdgeSort::Sort(initial, count, Kruskal::sortStrategy);
+    ConcurrentUnionFind components(numVertices);
+    for (int i = 0; i < count; i++) {
+        int e = storeEdge(initial[i].src, initial[i].dest, initial[i].weight);
+        if (components.UniteSequential(initial[i].src, initial[i].dest)) {
+            linkEdge(e);
+        }
+    }
+    delete[] initial;
+}
+
+/**
+ * @brief Checks whether a node is the root of its splay tree.
+ * @param x The node.
+ * @return True if x has no splay parent (its parent pointer, if any, is a path-parent pointer).
+ */
+bool DynamicMST::isSplayRoot(int x) const {
+    int p = nodes[x].parent;
+    return p == -1 || (nodes[p].child[0] != x && nodes[p].child[1] != x);
+}
+
+/**
+ * @brief Applies a pending reversal of a node to its children.
+ * @param x The node.
+ */
+void DynamicMST::pushDown(int x) {
+    Node &node = nodes[x];
+    if (node.flip) {
+        swap(node.child[0], node.child[1]);
+        for (int c : node.child) {
+            if (c != -1) nodes[c].flip = !nodes[c].flip;
+        }
+        node.flip = false;
+    }
+}
+
+/**
+ * @brief Recomputes the heaviest node of a splay subtree from its children.
+ * @param x The node.
+ */
+void DynamicMST::pull(int x) {
+    int best = x;
+    for (int c : nodes[x].child) {
+        if (c != -1 && nodes[nodes[c].maxNode].weight > nodes[best].weight) {
+            best = nodes[c].maxNode;
+        }
+    }
+    nodes[x].maxNode = best;
+}
+
+/**
+ * @brief Rotates a node above its splay parent.
+ * @param x The node; its parent must not be a splay root's path-parent.
+ */
+void DynamicMST::rotate(int x) {
+    int p = nodes[x].parent;
+    int g = nodes[p].parent;
+    int dir = nodes[p].child[1] == x ? 1 : 0;
+    int b = nodes[x].child[1 - dir];
+    if (!isSplayRoot(p)) {
+        nodes[g].child[nodes[g].child[1] == p ? 1 : 0] = x;
+    }
+    nodes[x].parent = g;
+    nodes[x].child[1 - dir] = p;
+    nodes[p].parent = x;
+    nodes[p].child[dir] = b;
+    if (b != -1) nodes[b].parent = p;
+    pull(p);
+    pull(x);
+}
+
+/**
+ * @brief Moves a node to the root of its splay tree.
+ *
+ * Pending reversals on the way from the splay root are applied first, top-down, so the rotations see the real
+ * child order.
+ *
+ * @param x The node.
+ */
+void DynamicMST::splay(int x) {
+    splayPath.clear();
+    int y = x;
+    splayPath.push_back(y);
+    while (!isSplayRoot(y)) {
+        y = nodes[y].parent;
+        splayPath.push_back(y);
+    }
+    for (int i = (int) splayPath.size() - 1; i >= 0; i--) {
+        pushDown(splayPath[i]);
+    }
+    while (!isSplayRoot(x)) {
+        int p = nodes[x].parent;
+        if (!isSplayRoot(p)) {
+            int g = nodes[p].parent;
+            bool sameSide = (nodes[g].child[0] == p) == (nodes[p].child[0] == x);
+            rotate(sameSide ? p : x);
+        }
+        rotate(x);
+    }
+}
+
+/**
+ * @brief Makes the path from the root of the represented tree to x preferred; x ends as its splay root.
+ * @param x The node.
+ */
+void DynamicMST::access(int x) {
+    int last = -1;
+    for (int y = x; y != -1; y = nodes[y].parent) {
+        splay(y);
+        nodes[y].child[1] = last;
+        pull(y);
+        last = y;
+    }
+    splay(x);
+}
+
+/**
+ * @brief Makes x the root of its represented tree.
+ * @param x The node.
+ */
+void DynamicMST::makeRoot(int x) {
+    access(x);
+    nodes[x].flip = !nodes[x].flip;
+}
+
+/**
+ * @brief Returns the root of the represented tree holding x.
+ * @param x The node.
+ * @return The root node.
+ */
+int DynamicMST::findRoot(int x) {
+    access(x);
+    int r = x;
+    pushDown(r);
+    while (nodes[r].child[0] != -1) {
+        r = nodes[r].child[0];
+        pushDown(r);
+    }
+    splay(r);
+    return r;
+}
+
+/**
+ * @brief Adds the tree edge (x, y) between two different trees.
+ * @param x The first node.
+ * @param y The second node.
+ */
+void DynamicMST::link(int x, int y) {
+    makeRoot(x);
+    nodes[x].parent = y;
+}
+
+/**
+ * @brief Removes the tree edge (x, y).
+ *
+ * With x as the root, accessing y leaves a two-node preferred path, so x is the only node left of y.
+ *
+ * @param x The first node.
+ * @param y The second node.
+ */
+void DynamicMST::cut(int x, int y) {
+    makeRoot(x);
+    access(y);
+    nodes[y].child[0] = -1;
+    nodes[x].parent = -1;
+    pull(y);
+}
+
+/**
+ * @brief Returns the heaviest tree edge on the path between two connected vertices.
+ * @param u The first vertex.
+ * @param v The second vertex.
+ * @return The id of the edge.
+ */
+int DynamicMST::heaviestOnPath(int u, int v) {
+    makeRoot(u);
+    access(v);
+    return nodes[v].maxNode - numVertices;
+}
+
+/**
+ * @brief Stores a new edge in the edge table and the incidence lists, outside the forest.
+ * @param u One end of the edge.
+ * @param v The other end of the edge.
+ * @param weight The weight of the edge.
+ * @return The id of the edge; ids of removed edges are reused.
+ */
+int DynamicMST::storeEdge(int u, int v, int weight) {
+    int e;
+    if (!freeEdges.empty()) {
+        e = freeEdges.back();
+        freeEdges.pop_back();
+    } else {
+        e = (int) edges.size();
+        edges.emplace_back();
+        nodes.emplace_back();
+        treePos.push_back(-1);
+    }
+    edges[e] = {u, v, weight, true, false, (int) incident[u].size(), (int) incident[v].size()};
+    incident[u].push_back(e);
+    incident[v].push_back(e);
+    nodes[numVertices + e] = {{-1, -1}, -1, false, weight, numVertices + e};
+    return e;
+}
+
+/**
+ * @brief Links a stored edge into the forest; its ends must be in different trees.
+ * @param e The edge.
+ */
+void DynamicMST::linkEdge(int e) {
+    int node = numVertices + e;
+    nodes[node] = {{-1, -1}, -1, false, edges[e].weight, node};
+    link(node, edges[e].u);
+    link(node, edges[e].v);
+    edges[e].inTree = true;
+    totalWeight += edges[e].weight;
+    treePos[e] = (int) tree.size();
+    tree.push_back(e);
+}
+
+/**
+ * @brief Cuts a tree edge out of the forest.
+ * @param e The edge.
+ */
+void DynamicMST::cutEdge(int e) {
+    int node = numVertices + e;
+    cut(node, edges[e].u);
+    cut(node, edges[e].v);
+    edges[e].inTree = false;
+    totalWeight -= edges[e].weight;
+    int last = tree.back();
+    tree[treePos[e]] = last;
+    treePos[last] = treePos[e];
+    tree.pop_back();
+    treePos[e] = -1;
+}
+
+/**
+ * @brief Stores a new edge and links it if it belongs to the forest.
+ *
+ * An edge between two trees joins them. Otherwise it closes a cycle and replaces the heaviest tree edge on it
+ * if it is strictly lighter.
+ *
+ * @param u One end of the edge.
+ * @param v The other end of the edge.
+ * @param weight The weight of the edge.
+ * @return True if the forest changed.
+ */
+bool DynamicMST::insertEdge(int u, int v, int weight) {
+    if (u == v || u < 0 || v < 0 || u >= numVertices || v >= numVertices) {
+        return false;
+    }
+    int e = storeEdge(u, v, weight);
+    if (findRoot(u) != findRoot(v)) {
+        linkEdge(e);
+        return true;
+    }
+    int heaviest = heaviestOnPath(u, v);
+    if (weight < edges[heaviest].weight) {
+        cutEdge(heaviest);
+        linkEdge(e);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Removes a stored edge, searching for a replacement if it was a tree edge.
+ * @param e The edge.
+ * @return True if the forest changed.
+ */
+bool DynamicMST::removeEdge(int e) {
+    bool wasTree = edges[e].inTree;
+    if (wasTree) {
+        cutEdge(e);
+    }
+    for (int end : {edges[e].u, edges[e].v}) {
+        vector<int> &list = incident[end];
+        int pos = end == edges[e].u ? edges[e].posU : edges[e].posV;
+        int moved = list.back();
+        list[pos] = moved;
+        list.pop_back();
+        if (moved != e) {
+            if (edges[moved].u == end) {
+                edges[moved].posU = pos;
+            } else {
+                edges[moved].posV = pos;
+            }
+        }
+    }
+    edges[e].alive = false;
+    freeEdges.push_back(e);
+    if (!wasTree) {
+        return false;
+    }
+    int replacement = findReplacement(edges[e].u, edges[e].v);
+    if (replacement != -1) {
+        linkEdge(replacement);
+    }
+    return true;
+}
+
+/**
+ * @brief Finds the lightest non-tree edge between the two trees holding a and b after a cut.
+ *
+ * Both trees are explored over tree edges one vertex at a time, alternating, until one of them is exhausted;
+ * the cost is proportional to the smaller tree. Every non-tree edge leaving the smaller tree ends in the other
+ * one, because before the cut both formed one component.
+ *
+ * @param a A vertex of the first tree.
+ * @param b A vertex of the second tree.
+ * @return The replacement edge, or -1 if a and b stay disconnected.
+ */
+int DynamicMST::findReplacement(int a, int b) {
+    stamp += 2;
+    int sides[2] = {stamp, stamp + 1};
+    vector<int> queues[2] = {{a}, {b}};
+    size_t heads[2] = {0, 0};
+    seen[a] = sides[0];
+    seen[b] = sides[1];
+
+    int complete = -1;
+    while (complete == -1) {
+        for (int s = 0; s < 2 && complete == -1; s++) {
+            if (heads[s] == queues[s].size()) {
+                complete = s;
+                break;
+            }
+            int x = queues[s][heads[s]++];
+            for (int e : incident[x]) {
+                if (!edges[e].inTree) continue;
+                int y = edges[e].u == x ? edges[e].v : edges[e].u;
+                if (seen[y] != sides[s]) {
+                    seen[y] = sides[s];
+                    queues[s].push_back(y);
+                }
+            }
+        }
+    }
+
+    int best = -1;
+    for (int x : queues[complete]) {
+        for (int e : incident[x]) {
+            if (edges[e].inTree) continue;
+            int y = edges[e].u == x ? edges[e].v : edges[e].u;
+            if (seen[y] != sides[complete] && (best == -1 || edges[e].weight < edges[best].weight)) {
+                best = e;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Finds an alive edge between u and v, scanning the shorter incidence list.
+ * @param u One end of the edge.
+ * @param v The other end of the edge.
+ * @return The edge, or -1 if there is none.
+ */
+int DynamicMST::findEdge(int u, int v) const {
+    if (u < 0 || v < 0 || u >= numVertices || v >= numVertices) {
+        return -1;
+    }
+    int from = incident[u].size() <= incident[v].size() ? u : v;
+    int to = from == u ? v : u;
+    for (int e : incident[from]) {
+        if ((edges[e].u == from && edges[e].v == to) || (edges[e].v == from && edges[e].u == to)) {
+            return e;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Applies one edge update and repairs the forest.
+ *
+ * A weight change that keeps the tree valid (a tree edge getting lighter, a non-tree edge getting heavier) only
+ * updates the weight. A heavier tree edge is cut and the lightest edge across the cut, possibly itself, is linked
+ * back; a lighter non-tree edge is handled like an insertion.
+ *
+ * @param update The update.
+ * @return True if the set of tree edges or their weights changed.
+ */
+bool DynamicMST::ApplyUpdate(const EdgeUpdate &update) {
+    auto start = chrono::high_resolution_clock::now();
+    bool changed = false;
+    int e = update.type == INSERT ? -1 : findEdge(update.u, update.v);
+
+    if (update.type == INSERT || (update.type == CHANGE && e == -1)) {
+        changed = insertEdge(update.u, update.v, update.weight);
+    } else if (update.type == REMOVE) {
+        changed = e != -1 && removeEdge(e);
+    } else if (update.weight != edges[e].weight) {
+        int node = numVertices + e;
+        int old = edges[e].weight;
+        if (edges[e].inTree && update.weight < old) {
+            access(node);
+            nodes[node].weight = update.weight;
+            pull(node);
+            edges[e].weight = update.weight;
+            totalWeight += update.weight - old;
+            changed = true;
+        } else if (edges[e].inTree) {
+            cutEdge(e);
+            edges[e].weight = update.weight;
+            linkEdge(findReplacement(edges[e].u, edges[e].v));
+            changed = true;
+        } else {
+            edges[e].weight = update.weight;
+            nodes[node].weight = update.weight;
+            nodes[node].maxNode = node;
+            int heaviest = heaviestOnPath(edges[e].u, edges[e].v);
+            if (update.weight < edges[heaviest].weight) {
+                cutEdge(heaviest);
+                linkEdge(e);
+                changed = true;
+            }
+        }
+    }
+
+    long long ns = chrono::duration_cast<chrono::nanoseconds>(chrono::high_resolution_clock::now() - start).count();
+    int bucket = 0;
+    while (bucket < LATENCY_BUCKETS - 1 && (ns >> (bucket + 1)) > 0) {
+        bucket++;
+    }
+    latency[update.type][bucket]++;
+    if (ns > maxLatency[update.type]) {
+        maxLatency[update.type] = ns;
+    }
+    return changed;
+}
+
+/**
+ * @brief Applies a batch of edge updates, in order.
+ * @param updates The updates.
+ * @param count The number of updates.
+ * @return The number of updates that changed the forest.
+ */
+int DynamicMST::ApplyUpdates(const EdgeUpdate *updates, int count) {
+    int changed = 0;
+    for (int i = 0; i < count; i++) {
+        if (ApplyUpdate(updates[i])) changed++;
+    }
+    return changed;
+}
+
+/**
+ * @brief Returns the total weight of the current forest.
+ * @return The sum of the tree edge weights.
+ */
+long long DynamicMST::TotalWeight() const {
+    return totalWeight;
+}
+
+/**
+ * @brief Returns the number of edges in the current forest.
+ * @return V minus the number of connected components.
+ */
+int DynamicMST::TreeSize() const {
+    return (int) tree.size();
+}
+
+/**
+ * @brief Copies the current tree edges.
+ * @param count Output: the number of edges.
+ * @return A new array of the tree edges.
+ */
+Kruskal::Edge* DynamicMST::TreeEdges(int *count) const {
+    *count = (int) tree.size();
+    Kruskal::Edge* result = new Kruskal::Edge[*count > 0 ? *count : 1];
+    for (int i = 0; i < *count; i++) {
+        const EdgeRecord &edge = edges[tree[i]];
+        result[i] = {edge.u, edge.v, edge.weight};
+    }
+    return result;
+}
+
+/**
+ * @brief Copies all current edges of the graph.
+ * @param count Output: the number of edges.
+ * @return A new array of the edges.
+ */
+Kruskal::Edge* DynamicMST::GraphEdges(int *count) const {
+    *count = (int) (edges.size() - freeEdges.size());
+    Kruskal::Edge* result = new Kruskal::Edge[*count > 0 ? *count : 1];
+    int i = 0;
+    for (const EdgeRecord &edge : edges) {
+        if (edge.alive) {
+            result[i++] = {edge.u, edge.v, edge.weight};
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the latency histogram of one update type.
+ * @param type The update type.
+ * @return LATENCY_BUCKETS counters; bucket b counts updates that took [2^b, 2^(b+1)) nanoseconds.
+ */
+const long long* DynamicMST::LatencyHistogram(UpdateType type) const {
+    return latency[type];
+}
+
+/**
+ * @brief Prints the latency histograms with their percentiles.
+ *
+ * Percentiles are read from the histogram, so they are the upper bound of the bucket they fall into.
+ */
+void DynamicMST::PrintLatencyHistograms() const {
+    const char* names[3] = {"Insert", "Remove", "Change"};
+    for (int t = 0; t < 3; t++) {
+        long long total = 0;
+        for (int b = 0; b < LATENCY_BUCKETS; b++) {
+            total += latency[t][b];
+        }
+        if (total == 0) continue;
+
+        long long percentiles[3] = {0, 0, 0};
+        const double levels[3] = {0.5, 0.9, 0.99};
+        for (int p = 0; p < 3; p++) {
+            long long cumulative = 0;
+            for (int b = 0; b < LATENCY_BUCKETS; b++) {
+                cumulative += latency[t][b];
+                if (cumulative >= levels[p] * total) {
+                    percentiles[p] = (1LL << (b + 1)) - 1;
+                    break;
+                }
+            }
+        }
+        printf("%s: %lld updates, p50 <= %.2f us, p90 <= %.2f us, p99 <= %.2f us, max %.2f us\n", names[t], total,
+               percentiles[0] / 1000.0, percentiles[1] / 1000.0, percentiles[2] / 1000.0, maxLatency[t] / 1000.0);
+        printf("  %-24s %-10s\n", "Latency [ns]", "Updates");
+        for (int b = 0; b < LATENCY_BUCKETS; b++) {
+            if (latency[t][b] == 0) continue;
+            int bar = (int) (latency[t][b] * 40 / total);
+            printf("  %10lld - %-11lld %-10lld %s\n", b == 0 ? 0LL : 1LL << b, (1LL << (b + 1)) - 1, latency[t][b],
+                   string(bar > 0 ? bar : 1, '#').c_str());
+        }
+    }
+}
+
+/**
+ * @brief Applies random edge updates, prints the latency histograms and checks the forest against Kruskal.
+ *
+ * A third of the updates inserts a random edge, a third removes an existing one and a third gives an existing
+ * edge a new weight. At evenly spaced checkpoints Kruskal's algorithm is rerun on the current edges, and its
+ * weight and edge count are compared with the maintained forest.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+void DynamicMST::TimeCounterList(slistEl **adjList, int numVertices) {
+    if (numVertices < 2) {
+        cout << "The graph needs at least two vertices" << endl;
+        return;
+    }
+    cout << "Give number of updates: ";
+    int numUpdates;
+    cin >> numUpdates;
+    cout << "Give number of checks against a full recomputation: ";
+    int checks;
+    cin >> checks;
+    cout << endl;
+    if (numUpdates < 0) numUpdates = 0;
+    if (checks <= 0) checks = 1;
+
+    auto start = chrono::high_resolution_clock::now();
+    DynamicMST dynamic(adjList, numVertices);
+    auto end = chrono::high_resolution_clock::now();
+    cout << "Initial forest: " << dynamic.TreeSize() << " edges, weight " << dynamic.TotalWeight() << ", built in "
+         << chrono::duration<double>(end - start).count() * 1000 << " ms" << endl;
+
+    int interval = numUpdates / checks > 0 ? numUpdates / checks : 1;
+    double updateTime = 0, recomputeTime = 0;
+    int changed = 0, recomputes = 0, mismatches = 0;
+    for (int i = 1; i <= numUpdates; i++) {
+        EdgeUpdate update;
+        int kind = rand() % 3;
+        int existing = -1;
+        for (int attempt = 0; attempt < 8 && existing == -1 && kind != 0; attempt++) {
+            int u = rand() % numVertices;
+            if (!dynamic.incident[u].empty()) {
+                existing = dynamic.incident[u][rand() % dynamic.incident[u].size()];
+            }
+        }
+        if (existing == -1) {
+            int u = rand() % numVertices;
+            int v = (u + 1 + rand() % (numVertices - 1)) % numVertices;
+            update = {INSERT, u, v, rand() % 50 + 1};
+        } else if (kind == 1) {
+            update = {REMOVE, dynamic.edges[existing].u, dynamic.edges[existing].v, 0};
+        } else {
+            update = {CHANGE, dynamic.edges[existing].u, dynamic.edges[existing].v, rand() % 50 + 1};
+        }
+
+        start = chrono::high_resolution_clock::now();
+        if (dynamic.ApplyUpdate(update)) changed++;
+        end = chrono::high_resolution_clock::now();
+        updateTime += chrono::duration<double>(end - start).count();
+
+        if (i % interval == 0 || i == numUpdates) {
+            int count;
+            Kruskal::Edge* current = dynamic.GraphEdges(&count);
+            start = chrono::high_resolution_clock::now();
+            long long expected = Kruskal::AlgorithmCalculationFromEdges(current, count, numVertices, false);
+            end = chrono::high_resolution_clock::now();
+            recomputeTime += chrono::duration<double>(end - start).count();
+            recomputes++;
+            if (expected != dynamic.TotalWeight() || Kruskal::mstSize != dynamic.TreeSize()) {
+                mismatches++;
+            }
+            delete[] current;
+        }
+    }
+
+    if (numUpdates > 0) {
+        cout << "Updates that changed the forest: " << changed << " of " << numUpdates << endl;
+        cout << "Average update time: " << updateTime / numUpdates * 1e6 << " us" << endl;
+        cout << "Average recompute time: " << recomputeTime / recomputes * 1e6 << " us" << endl;
+        cout << "Final forest: " << dynamic.TreeSize() << " edges, weight " << dynamic.TotalWeight() << endl;
+        if (mismatches > 0) {
+            cout << "Forest mismatches against Kruskal: " << mismatches << " of " << recomputes << " checks" << endl;
+        }
+        dynamic.PrintLatencyHistograms();
+    }
+}
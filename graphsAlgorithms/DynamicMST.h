@@ -0,0 +1,256 @@
+/**
+ * @file DynamicMST.h
+ * @brief This file contains the declaration of the DynamicMST class.
+ */
+
+#ifndef DYNAMICMST_H
+#define DYNAMICMST_H
+
+#include <vector>
+#include "../GraphsGenerating.h"
+#include "Kruskal.h"
+
+/**
+ * @class DynamicMST
+ * @brief Class keeping a minimum spanning forest up to date while the edges of an undirected graph change.
+ *
+ * The forest is stored in a link-cut tree in which every tree edge is a node of its own between its two
+ * endpoints, so the heaviest edge on the tree path between two vertices is found in O(log V) amortized time.
+ * An inserted edge either joins two trees or replaces the heaviest edge of the cycle it closes. When a tree edge
+ * is removed, the two halves are explored in lockstep over tree edges until the smaller one is complete, and the
+ * lightest non-tree edge leaving it becomes the replacement. The latency of every update is recorded in a
+ * histogram per update type.
+ */
+class DynamicMST {
+public:
+    /**
+     * @enum UpdateType
+     * @brief Kind of an edge update.
+     */
+    enum UpdateType {
+        INSERT, ///< Adds an edge (parallel edges are allowed)
+        REMOVE, ///< Removes one edge between the two vertices
+        CHANGE ///< Sets a new weight of one edge between the two vertices (a missing edge is inserted)
+    };
+
+    /**
+     * @struct EdgeUpdate
+     * @brief A single undirected edge update.
+     */
+    struct EdgeUpdate {
+        UpdateType type; ///< The kind of update
+        int u; ///< One end of the edge
+        int v; ///< The other end of the edge
+        int weight; ///< The new weight (ignored by REMOVE)
+    };
+
+    /**
+     * @brief Copies the edges of the graph and builds the initial forest with Kruskal's algorithm.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    DynamicMST(slistEl **adjList, int numVertices);
+
+    DynamicMST(const DynamicMST &) = delete;
+    DynamicMST &operator=(const DynamicMST &) = delete;
+
+    /**
+     * @brief Applies one edge update and repairs the forest.
+     * @param update The update.
+     * @return True if the set of tree edges or their weights changed.
+     */
+    bool ApplyUpdate(const EdgeUpdate &update);
+
+    /**
+     * @brief Applies a batch of edge updates, in order.
+     * @param updates The updates.
+     * @param count The number of updates.
+     * @return The number of updates that changed the forest.
+     */
+    int ApplyUpdates(const EdgeUpdate *updates, int count);
+
+    /**
+     * @brief Returns the total weight of the current forest.
+     * @return The sum of the tree edge weights.
+     */
+    long long TotalWeight() const;
+
+    /**
+     * @brief Returns the number of edges in the current forest.
+     * @return V minus the number of connected components.
+     */
+    int TreeSize() const;
+
+    /**
+     * @brief Copies the current tree edges.
+     * @param count Output: the number of edges.
+     * @return A new array of the tree edges.
+     */
+    Kruskal::Edge* TreeEdges(int *count) const;
+
+    /**
+     * @brief Copies all current edges of the graph.
+     * @param count Output: the number of edges.
+     * @return A new array of the edges.
+     */
+    Kruskal::Edge* GraphEdges(int *count) const;
+
+    /**
+     * @brief Returns the latency histogram of one update type.
+     * @param type The update type.
+     * @return LATENCY_BUCKETS counters; bucket b counts updates that took [2^b, 2^(b+1)) nanoseconds.
+     */
+    const long long* LatencyHistogram(UpdateType type) const;
+
+    /**
+     * @brief Prints the latency histograms with their percentiles.
+     */
+    void PrintLatencyHistograms() const;
+
+    /**
+     * @brief Applies random edge updates, prints the latency histograms and checks the forest against Kruskal.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices);
+
+    static const int LATENCY_BUCKETS = 40; ///< Number of power-of-two latency buckets
+
+private:
+    /**
+     * @struct Node
+     * @brief A link-cut tree node: a vertex (weight INT_MIN) or a tree edge.
+     */
+    struct Node {
+        int child[2]; // Children in the splay tree of the preferred path
+        int parent; // Splay parent, or the path-parent pointer at a splay root
+        bool flip; // Pending reversal of the subtree
+        int weight;
+        int maxNode; // Heaviest node in the splay subtree
+    };
+
+    /**
+     * @struct EdgeRecord
+     * @brief An edge of the graph and its place in the incidence lists and the forest.
+     */
+    struct EdgeRecord {
+        int u;
+        int v;
+        int weight;
+        bool alive;
+        bool inTree;
+        int posU; // Position in incident[u]
+        int posV; // Position in incident[v]
+    };
+
+    /**
+     * @brief Checks whether a node is the root of its splay tree.
+     */
+    bool isSplayRoot(int x) const;
+
+    /**
+     * @brief Applies a pending reversal of a node to its children.
+     */
+    void pushDown(int x);
+
+    /**
+     * @brief Recomputes the heaviest node of a splay subtree from its children.
+     */
+    void pull(int x);
+
+    /**
+     * @brief Rotates a node above its splay parent.
+     */
+    void rotate(int x);
+
+    /**
+     * @brief Moves a node to the root of its splay tree.
+     */
+    void splay(int x);
+
+    /**
+     * @brief Makes the path from the root of the represented tree to x preferred; x ends as its splay root.
+     */
+    void access(int x);
+
+    /**
+     * @brief Makes x the root of its represented tree.
+     */
+    void makeRoot(int x);
+
+    /**
+     * @brief Returns the root of the represented tree holding x.
+     */
+    int findRoot(int x);
+
+    /**
+     * @brief Adds the tree edge (x, y) between two different trees.
+     */
+    void link(int x, int y);
+
+    /**
+     * @brief Removes the tree edge (x, y).
+     */
+    void cut(int x, int y);
+
+    /**
+     * @brief Returns the heaviest tree edge on the path between two connected vertices.
+     */
+    int heaviestOnPath(int u, int v);
+
+    /**
+     * @brief Stores a new edge in the edge table and the incidence lists, outside the forest.
+     * @return The id of the edge.
+     */
+    int storeEdge(int u, int v, int weight);
+
+    /**
+     * @brief Links a stored edge into the forest.
+     */
+    void linkEdge(int e);
+
+    /**
+     * @brief Cuts a tree edge out of the forest.
+     */
+    void cutEdge(int e);
+
+    /**
+     * @brief Stores a new edge and links it if it belongs to the forest.
+     * @return True if the forest changed.
+     */
+    bool insertEdge(int u, int v, int weight);
+
+    /**
+     * @brief Removes a stored edge, searching for a replacement if it was a tree edge.
+     * @return True if the forest changed.
+     */
+    bool removeEdge(int e);
+
+    /**
+     * @brief Finds the lightest non-tree edge between the two trees holding a and b after a cut.
+     * @return The replacement edge, or -1 if a and b stay disconnected.
+     */
+    int findReplacement(int a, int b);
+
+    /**
+     * @brief Finds an alive edge between u and v.
+     * @return The edge, or -1 if there is none.
+     */
+    int findEdge(int u, int v) const;
+
+    int numVertices;
+    std::vector<Node> nodes; // Vertex v is node v, edge e is node numVertices + e
+    std::vector<EdgeRecord> edges;
+    std::vector<int> freeEdges; // Removed edge ids, reused first
+    std::vector<std::vector<int>> incident; // Alive edges at every vertex
+    std::vector<int> tree; // Tree edges, in no particular order
+    std::vector<int> treePos; // Position of every tree edge in tree
+    std::vector<int> splayPath; // Scratch stack for splay
+    std::vector<int> seen; // Exploration stamps for the replacement search
+    int stamp;
+    long long totalWeight;
+    long long latency[3][LATENCY_BUCKETS];
+    long long maxLatency[3];
+};
+
+#endif // DYNAMICMST_H
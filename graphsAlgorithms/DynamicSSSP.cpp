@@ -0,0 +1,376 @@
+/**
+ * @file DynamicSSSP.cpp
+ * @brief This file contains the implementation of the DynamicSSSP class.
+ */
+
+#include "DynamicSSSP.h"
+#include "Dijkstra.h"
+#include <iostream>
+#include <climits>
+#include <cstdlib>
+#include <chrono>
+
+using namespace std;
+
+/**
+ * @brief Copies the graph and computes the initial shortest path tree with Dijkstra's algorithm.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param source The source vertex.
+ */
+DynamicSSSP::DynamicSSSP(slistEl **adjList, int numVertices, int source) {
+    this->numVertices = numVertices;
+    this->source = source;
+    out = new slistEl*[numVertices]();
+    in = new slistEl*[numVertices]();
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            out[u] = new slistEl{p->v, p->weight, out[u]};
+            in[p->v] = new slistEl{u, p->weight, in[p->v]};
+        }
+    }
+
+    pair<int*, int*> initial = Dijkstra::AlgorithmCalculationFromList(out, numVertices, source);
+    dist = initial.first;
+    prev = initial.second;
+
+    firstChild = new int[numVertices];
+    nextSibling = new int[numVertices];
+    prevSibling = new int[numVertices];
+    affected = new bool[numVertices]();
+    for (int v = 0; v < numVertices; v++) {
+        firstChild[v] = -1;
+        nextSibling[v] = -1;
+        prevSibling[v] = -1;
+    }
+    for (int v = 0; v < numVertices; v++) {
+        int parent = prev[v];
+        prev[v] = -1;
+        setParent(v, parent);
+    }
+
+    pq = new PriorityQueue(numVertices, dist);
+}
+
+/**
+ * @brief Destructor for the DynamicSSSP class.
+ */
+DynamicSSSP::~DynamicSSSP() {
+    for (int i = 0; i < numVertices; i++) {
+        slistEl *p = out[i];
+        while (p) {
+            slistEl *r = p;
+            p = p->next;
+            delete r;
+        }
+        p = in[i];
+        while (p) {
+            slistEl *r = p;
+            p = p->next;
+            delete r;
+        }
+    }
+    delete[] out;
+    delete[] in;
+    delete[] dist;
+    delete[] prev;
+    delete[] firstChild;
+    delete[] nextSibling;
+    delete[] prevSibling;
+    delete[] affected;
+    delete pq;
+}
+
+/**
+ * @brief Moves v below a new parent in the shortest path tree.
+ * @param v The vertex.
+ * @param parent The new parent, or -1 to detach v.
+ */
+void DynamicSSSP::setParent(int v, int parent) {
+    if (prev[v] != -1) {
+        if (prevSibling[v] != -1) {
+            nextSibling[prevSibling[v]] = nextSibling[v];
+        } else {
+            firstChild[prev[v]] = nextSibling[v];
+        }
+        if (nextSibling[v] != -1) {
+            prevSibling[nextSibling[v]] = prevSibling[v];
+        }
+    }
+    prev[v] = parent;
+    prevSibling[v] = -1;
+    nextSibling[v] = -1;
+    if (parent != -1) {
+        nextSibling[v] = firstChild[parent];
+        if (firstChild[parent] != -1) {
+            prevSibling[firstChild[parent]] = v;
+        }
+        firstChild[parent] = v;
+    }
+}
+
+/**
+ * @brief Sets the weight of the edge (u, v), inserting it if missing.
+ * @param u The source vertex of the edge.
+ * @param v The destination vertex of the edge.
+ * @param weight The new weight.
+ * @return The previous weight, or -1 if the edge did not exist.
+ */
+int DynamicSSSP::setEdge(int u, int v, int weight) {
+    for (slistEl* p = out[u]; p != nullptr; p = p->next) {
+        if (p->v == v) {
+            int old = p->weight;
+            p->weight = weight;
+            for (slistEl* r = in[v]; r != nullptr; r = r->next) {
+                if (r->v == u && r->weight == old) {
+                    r->weight = weight;
+                    break;
+                }
+            }
+            return old;
+        }
+    }
+    out[u] = new slistEl{v, weight, out[u]};
+    in[v] = new slistEl{u, weight, in[v]};
+    return -1;
+}
+
+/**
+ * @brief Removes the edge (u, v).
+ * @param u The source vertex of the edge.
+ * @param v The destination vertex of the edge.
+ * @return The removed weight, or -1 if the edge did not exist.
+ */
+int DynamicSSSP::removeEdge(int u, int v) {
+    int old = -1;
+    for (slistEl** link = &out[u]; *link != nullptr; link = &(*link)->next) {
+        if ((*link)->v == v) {
+            slistEl *r = *link;
+            old = r->weight;
+            *link = r->next;
+            delete r;
+            break;
+        }
+    }
+    if (old == -1) {
+        return -1;
+    }
+    for (slistEl** link = &in[v]; *link != nullptr; link = &(*link)->next) {
+        if ((*link)->v == u && (*link)->weight == old) {
+            slistEl *r = *link;
+            *link = r->next;
+            delete r;
+            break;
+        }
+    }
+    return old;
+}
+
+/**
+ * @brief Applies a batch of edge updates and repairs the shortest path tree.
+ *
+ * Increased or removed tree edges invalidate the subtree below them: those vertices are detached and get a
+ * tentative distance from their non-invalidated in-neighbours. Decreased or inserted edges are relaxed directly.
+ * A Dijkstra pass seeded with all these vertices then settles exactly the region whose distances change.
+ *
+ * @param updates The updates to apply, in order.
+ * @param count The number of updates.
+ * @return The number of vertices the repair touched.
+ */
+int DynamicSSSP::ApplyUpdates(const EdgeUpdate *updates, int count) {
+    int* roots = new int[count];
+    int numRoots = 0;
+    int* decreased = new int[count];
+    int numDecreased = 0;
+
+    for (int i = 0; i < count; i++) {
+        const EdgeUpdate &update = updates[i];
+        if (update.type == REMOVE) {
+            int old = removeEdge(update.u, update.v);
+            if (old != -1 && prev[update.v] == update.u) {
+                roots[numRoots++] = update.v;
+            }
+        } else {
+            int old = setEdge(update.u, update.v, update.weight);
+            if (old == -1 || update.weight < old) {
+                decreased[numDecreased++] = i;
+            } else if (update.weight > old && prev[update.v] == update.u) {
+                roots[numRoots++] = update.v;
+            }
+        }
+    }
+
+    // Invalidate the subtrees below every increased or removed tree edge
+    int* region = new int[numVertices];
+    int regionSize = 0;
+    for (int r = 0; r < numRoots; r++) {
+        if (affected[roots[r]]) continue;
+        affected[roots[r]] = true;
+        region[regionSize++] = roots[r];
+        for (int i = regionSize - 1; i < regionSize; i++) {
+            for (int c = firstChild[region[i]]; c != -1; c = nextSibling[c]) {
+                if (!affected[c]) {
+                    affected[c] = true;
+                    region[regionSize++] = c;
+                }
+            }
+        }
+    }
+    for (int i = 0; i < regionSize; i++) {
+        setParent(region[i], -1);
+        dist[region[i]] = INT_MAX;
+    }
+    for (int i = 0; i < regionSize; i++) {
+        int v = region[i];
+        int parent = -1;
+        for (slistEl* p = in[v]; p != nullptr; p = p->next) {
+            int u = p->v;
+            if (!affected[u] && dist[u] != INT_MAX && dist[u] + p->weight < dist[v]) {
+                dist[v] = dist[u] + p->weight;
+                parent = u;
+            }
+        }
+        if (parent != -1) {
+            setParent(v, parent);
+            pq->push(v);
+        }
+    }
+
+    // Relax every decreased or inserted edge that still exists
+    for (int i = 0; i < numDecreased; i++) {
+        int u = updates[decreased[i]].u;
+        int v = updates[decreased[i]].v;
+        if (dist[u] == INT_MAX) continue;
+        for (slistEl* p = out[u]; p != nullptr; p = p->next) {
+            if (p->v == v && dist[u] + p->weight < dist[v]) {
+                dist[v] = dist[u] + p->weight;
+                setParent(v, u);
+                pq->push(v);
+            }
+        }
+    }
+
+    int touched = regionSize;
+    while (!pq->isEmpty()) {
+        int u = pq->pop();
+        touched++;
+        for (slistEl* p = out[u]; p != nullptr; p = p->next) {
+            int v = p->v;
+            if (dist[u] + p->weight < dist[v]) {
+                dist[v] = dist[u] + p->weight;
+                setParent(v, u);
+                pq->push(v);
+            }
+        }
+    }
+
+    for (int i = 0; i < regionSize; i++) {
+        affected[region[i]] = false;
+    }
+    delete[] region;
+    delete[] roots;
+    delete[] decreased;
+    return touched;
+}
+
+/**
+ * @brief Returns the current shortest distances from the source.
+ * @return The array of distances; INT_MAX marks unreachable vertices.
+ */
+const int* DynamicSSSP::Distances() const {
+    return dist;
+}
+
+/**
+ * @brief Returns the current shortest path tree.
+ * @return The array of previous vertices; -1 for the source and unreachable vertices.
+ */
+const int* DynamicSSSP::Previous() const {
+    return prev;
+}
+
+/**
+ * @brief Returns the maintained copy of the graph.
+ * @return The adjacency list after all applied updates.
+ */
+slistEl** DynamicSSSP::Graph() const {
+    return out;
+}
+
+/**
+ * @brief Applies random batches of edge updates and compares the repair against rerunning Dijkstra.
+ *
+ * Most updates change the weight of an existing edge; a tenth removes one and a tenth inserts a new one. After
+ * every batch the repaired distances are checked against a full recomputation on the updated graph.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param source The source vertex.
+ */
+void DynamicSSSP::TimeCounterList(slistEl **adjList, int numVertices, int source) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Give number of batches: ";
+    int batches;
+    cin >> batches;
+    cout << "Give number of edge updates per batch: ";
+    int batchSize;
+    cin >> batchSize;
+    cout << endl;
+
+    DynamicSSSP dynamic(adjList, numVertices, source);
+    EdgeUpdate* updates = new EdgeUpdate[batchSize > 0 ? batchSize : 1];
+    double repairTime = 0, recomputeTime = 0;
+    long long touched = 0;
+    int mismatches = 0;
+
+    for (int b = 0; b < batches; b++) {
+        for (int i = 0; i < batchSize; i++) {
+            int kind = rand() % 10;
+            int u = rand() % numVertices;
+            slistEl* edge = dynamic.out[u];
+            int degree = 0;
+            for (slistEl* p = edge; p != nullptr; p = p->next) degree++;
+            if (degree > 0) {
+                for (int skip = rand() % degree; skip > 0; skip--) edge = edge->next;
+            }
+            if (kind == 0 || edge == nullptr) {
+                updates[i] = {INSERT, u, rand() % numVertices, rand() % 50 + 1};
+            } else if (kind == 1) {
+                updates[i] = {REMOVE, u, edge->v, 0};
+            } else {
+                updates[i] = {CHANGE, u, edge->v, rand() % 50 + 1};
+            }
+        }
+
+        auto start = chrono::high_resolution_clock::now();
+        touched += dynamic.ApplyUpdates(updates, batchSize);
+        auto end = chrono::high_resolution_clock::now();
+        repairTime += chrono::duration<double>(end - start).count();
+
+        start = chrono::high_resolution_clock::now();
+        pair<int*, int*> fresh = Dijkstra::AlgorithmCalculationFromList(dynamic.Graph(), numVertices, source);
+        end = chrono::high_resolution_clock::now();
+        recomputeTime += chrono::duration<double>(end - start).count();
+
+        for (int v = 0; v < numVertices; v++) {
+            if (fresh.first[v] != dynamic.dist[v]) {
+                mismatches++;
+            }
+        }
+        delete[] fresh.first;
+        delete[] fresh.second;
+    }
+
+    if (batches > 0) {
+        cout << "Average touched vertices per batch: " << (double) touched / batches << endl;
+        cout << "Average repair time: " << repairTime / batches * 1000 << " ms" << endl;
+        cout << "Average recompute time: " << recomputeTime / batches * 1000 << " ms" << endl;
+        if (mismatches > 0) {
+            cout << "Distance mismatches: " << mismatches << endl;
+        }
+    }
+    delete[] updates;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file DynamicSSSP.h
+ * @brief This file contains the declaration of the DynamicSSSP class.
+ */
+
+#ifndef DYNAMICSSSP_H
+#define DYNAMICSSSP_H
+
+#include "../GraphsGenerating.h"
+
+class PriorityQueue;
+
+/**
+ * @class DynamicSSSP
+ * @brief Class keeping single-source shortest paths up to date while the edges of the graph change.
+ *
+ * The structure owns a copy of the graph together with the dist/prev arrays of one source. A batch of edge
+ * insertions, deletions and weight changes is repaired in the style of Ramalingam and Reps: only the shortest path
+ * subtrees hanging below increased or removed tree edges are invalidated, and a Dijkstra pass seeded with the
+ * invalidated and improved vertices settles the affected region. Edge weights must be non-negative.
+ */
+class DynamicSSSP {
+public:
+    /**
+     * @enum UpdateType
+     * @brief Kind of an edge update.
+     */
+    enum UpdateType {
+        INSERT, ///< Adds the edge (an existing edge gets the new weight)
+        REMOVE, ///< Removes the edge
+        CHANGE ///< Sets a new weight (a missing edge is inserted)
+    };
+
+    /**
+     * @struct EdgeUpdate
+     * @brief A single directed edge update.
+     */
+    struct EdgeUpdate {
+        UpdateType type; ///< The kind of update
+        int u; ///< The source vertex of the edge
+        int v; ///< The destination vertex of the edge
+        int weight; ///< The new weight (ignored by REMOVE)
+    };
+
+    /**
+     * @brief Copies the graph and computes the initial shortest path tree with Dijkstra's algorithm.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param source The source vertex.
+     */
+    DynamicSSSP(slistEl **adjList, int numVertices, int source);
+
+    /**
+     * @brief Destructor for the DynamicSSSP class.
+     */
+    ~DynamicSSSP();
+
+    /**
+     * @brief Applies a batch of edge updates and repairs the shortest path tree.
+     * @param updates The updates to apply, in order.
+     * @param count The number of updates.
+     * @return The number of vertices the repair touched.
+     */
+    int ApplyUpdates(const EdgeUpdate *updates, int count);
+
+    /**
+     * @brief Returns the current shortest distances from the source.
+     * @return The array of distances; INT_MAX marks unreachable vertices.
+     */
+    const int* Distances() const;
+
+    /**
+     * @brief Returns the current shortest path tree.
+     * @return The array of previous vertices; -1 for the source and unreachable vertices.
+     */
+    const int* Previous() const;
+
+    /**
+     * @brief Returns the maintained copy of the graph.
+     * @return The adjacency list after all applied updates.
+     */
+    slistEl** Graph() const;
+
+    /**
+     * @brief Applies random batches of edge updates and compares the repair against rerunning Dijkstra.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param source The source vertex.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices, int source);
+
+private:
+    /**
+     * @brief Moves v below a new parent in the shortest path tree.
+     * @param v The vertex.
+     * @param parent The new parent, or -1 to detach v.
+     */
+    void setParent(int v, int parent);
+
+    /**
+     * @brief Sets the weight of the edge (u, v), inserting it if missing.
+     * @return The previous weight, or -1 if the edge did not exist.
+     */
+    int setEdge(int u, int v, int weight);
+
+    /**
+     * @brief Removes the edge (u, v).
+     * @return The removed weight, or -1 if the edge did not exist.
+     */
+    int removeEdge(int u, int v);
+
+    int numVertices;
+    int source;
+    slistEl **out; // Outgoing edges of every vertex
+    slistEl **in; // Incoming edges of every vertex (slistEl::v holds the tail)
+    int *dist;
+    int *prev;
+    int *firstChild; // Shortest path tree, as doubly linked child lists
+    int *nextSibling;
+    int *prevSibling;
+    bool *affected; // Scratch flags for the invalidated region
+    PriorityQueue *pq; // Heap over dist, kept between batches so a repair does not pay O(V) setup
+};
+
+#endif // DYNAMICSSSP_H
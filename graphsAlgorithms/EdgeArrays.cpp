@@ -0,0 +1,129 @@
+/**
+ * @file EdgeArrays.cpp
+ * @brief This file contains the implementation of the EdgeArrays class.
+ */
+
+#include "EdgeArrays.h"
+#include "SimdKernels.h"
+
+/**
+ * @brief Extracts the edges of an incidence matrix, scanning every row once.
+ *
+ * A positive cell marks the start vertex of an edge and holds its weight, a negative cell marks the end vertex.
+ * Columns without both endpoints are dropped.
+ *
+ * @param incMatrix The incidence matrix representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param numEdges The number of edges in the graph.
+ */
+EdgeArrays::EdgeArrays(int **incMatrix, int numVertices, int numEdges) {
+    this->numVertices = numVertices;
+    int* columnSrc = new int[numEdges > 0 ? numEdges : 1];
+    int* columnDst = new int[numEdges > 0 ? numEdges : 1];
+    int* columnWeight = new int[numEdges > 0 ? numEdges : 1];
+    int* positions = new int[numEdges > 0 ? numEdges : 1];
+    for (int e = 0; e < numEdges; e++) {
+        columnSrc[e] = -1;
+        columnDst[e] = -1;
+    }
+    for (int vertex = 0; vertex < numVertices; vertex++) {
+        int count = SimdKernels::NonZeroPositions(incMatrix[vertex], numEdges, positions);
+        for (int i = 0; i < count; i++) {
+            int e = positions[i];
+            if (incMatrix[vertex][e] > 0) {
+                columnSrc[e] = vertex;
+                columnWeight[e] = incMatrix[vertex][e];
+            } else {
+                columnDst[e] = vertex;
+            }
+        }
+    }
+
+    this->numEdges = 0;
+    for (int e = 0; e < numEdges; e++) {
+        if (columnSrc[e] != -1 && columnDst[e] != -1) this->numEdges++;
+    }
+    src = new int[this->numEdges > 0 ? this->numEdges : 1];
+    dst = new int[this->numEdges > 0 ? this->numEdges : 1];
+    weight = new int[this->numEdges > 0 ? this->numEdges : 1];
+    int k = 0;
+    for (int e = 0; e < numEdges; e++) {
+        if (columnSrc[e] != -1 && columnDst[e] != -1) {
+            src[k] = columnSrc[e];
+            dst[k] = columnDst[e];
+            weight[k] = columnWeight[e];
+            k++;
+        }
+    }
+    delete[] columnSrc;
+    delete[] columnDst;
+    delete[] columnWeight;
+    delete[] positions;
+    sortByDestination();
+}
+
+/**
+ * @brief Copies the edges of an adjacency list.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+EdgeArrays::EdgeArrays(slistEl **adjList, int numVertices) {
+    this->numVertices = numVertices;
+    numEdges = 0;
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            numEdges++;
+        }
+    }
+    src = new int[numEdges > 0 ? numEdges : 1];
+    dst = new int[numEdges > 0 ? numEdges : 1];
+    weight = new int[numEdges > 0 ? numEdges : 1];
+    int k = 0;
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            src[k] = u;
+            dst[k] = p->v;
+            weight[k] = p->weight;
+            k++;
+        }
+    }
+    sortByDestination();
+}
+
+/**
+ * @brief Destructor for the EdgeArrays class.
+ */
+EdgeArrays::~EdgeArrays() {
+    delete[] src;
+    delete[] dst;
+    delete[] weight;
+}
+
+/**
+ * @brief Reorders the edges by destination with a counting sort; the order within a destination is kept.
+ */
+void EdgeArrays::sortByDestination() {
+    int* start = new int[numVertices + 1]();
+    for (int e = 0; e < numEdges; e++) {
+        start[dst[e] + 1]++;
+    }
+    for (int v = 0; v < numVertices; v++) {
+        start[v + 1] += start[v];
+    }
+    int* sortedSrc = new int[numEdges > 0 ? numEdges : 1];
+    int* sortedDst = new int[numEdges > 0 ? numEdges : 1];
+    int* sortedWeight = new int[numEdges > 0 ? numEdges : 1];
+    for (int e = 0; e < numEdges; e++) {
+        int position = start[dst[e]]++;
+        sortedSrc[position] = src[e];
+        sortedDst[position] = dst[e];
+        sortedWeight[position] = weight[e];
+    }
+    delete[] start;
+    delete[] src;
+    delete[] dst;
+    delete[] weight;
+    src = sortedSrc;
+    dst = sortedDst;
+    weight = sortedWeight;
+}
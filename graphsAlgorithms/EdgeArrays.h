@@ -0,0 +1,56 @@
+/**
+ * @file EdgeArrays.h
+ * @brief This file contains the declaration of the EdgeArrays class.
+ */
+
+#ifndef EDGEARRAYS_H
+#define EDGEARRAYS_H
+
+#include "../GraphsGenerating.h"
+
+/**
+ * @class EdgeArrays
+ * @brief Class storing the directed edges of a graph as separate source, destination and weight arrays.
+ *
+ * The edges are sorted by destination, so a pass over them reads the three arrays sequentially and the writes to
+ * the distance array move forward through memory. This is the layout the vectorized Bellman-Ford passes work on.
+ */
+class EdgeArrays {
+public:
+    /**
+     * @brief Extracts the edges of an incidence matrix, scanning every row once.
+     * @param incMatrix The incidence matrix representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param numEdges The number of edges in the graph.
+     */
+    EdgeArrays(int **incMatrix, int numVertices, int numEdges);
+
+    /**
+     * @brief Copies the edges of an adjacency list.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    EdgeArrays(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Destructor for the EdgeArrays class.
+     */
+    ~EdgeArrays();
+
+    EdgeArrays(const EdgeArrays &) = delete;
+    EdgeArrays &operator=(const EdgeArrays &) = delete;
+
+    int numVertices; ///< The number of vertices
+    int numEdges; ///< The number of directed edges
+    int *src; ///< Source vertex of every edge
+    int *dst; ///< Destination vertex of every edge, non-decreasing
+    int *weight; ///< Weight of every edge
+
+private:
+    /**
+     * @brief Reorders the edges by destination with a counting sort; the order within a destination is kept.
+     */
+    void sortByDestination();
+};
+
+#endif // EDGEARRAYS_H
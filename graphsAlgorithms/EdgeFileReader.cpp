@@ -0,0 +1,169 @@
+/**
+ * @file EdgeFileReader.cpp
+ * @brief This file contains the implementation of the EdgeFileReader class.
+ */
+
+#include "EdgeFileReader.h"
+#include <cstring>
+
+using namespace std;
+
+/**
+ * @brief Opens an edge file and reads its header.
+ * @param path The path of the file, or "-" for standard input.
+ */
+EdgeFileReader::EdgeFileReader(const char *path) {
+    ownsFile = strcmp(path, "-") != 0;
+    file = ownsFile ? fopen(path, "rb") : stdin;
+    buffer = new char[BUFFER_SIZE];
+    position = 0;
+    length = 0;
+    numVertices = 0;
+    declaredEdges = 0;
+    bytesRead = 0;
+    skippedEdges = 0;
+    open = false;
+
+    long long edges, vertices;
+    if (file != nullptr && readInt(edges) && readInt(vertices) && vertices >= 0 && vertices <= 0x7fffffff) {
+        declaredEdges = edges;
+        numVertices = (int) vertices;
+        open = true;
+    }
+}
+
+/**
+ * @brief Destructor for the EdgeFileReader class; closes the file.
+ */
+EdgeFileReader::~EdgeFileReader() {
+    if (ownsFile && file != nullptr) {
+        fclose(file);
+    }
+    delete[] buffer;
+}
+
+/**
+ * @brief Checks whether the file was opened and its header read.
+ * @return True if edges can be read.
+ */
+bool EdgeFileReader::IsOpen() const {
+    return open;
+}
+
+/**
+ * @brief Returns the number of vertices declared in the header.
+ * @return The number of vertices.
+ */
+int EdgeFileReader::NumVertices() const {
+    return numVertices;
+}
+
+/**
+ * @brief Returns the number of edges declared in the header.
+ * @return The number of edges; the file may actually hold a different number.
+ */
+long long EdgeFileReader::DeclaredEdges() const {
+    return declaredEdges;
+}
+
+/**
+ * @brief Returns the number of bytes read from the file so far.
+ * @return The number of bytes.
+ */
+long long EdgeFileReader::BytesRead() const {
+    return bytesRead;
+}
+
+/**
+ * @brief Returns the number of edges skipped because an end was out of range.
+ * @return The number of skipped edges.
+ */
+long long EdgeFileReader::SkippedEdges() const {
+    return skippedEdges;
+}
+
+/**
+ * @brief Reads the next chunk of the file into the buffer.
+ * @return False at the end of the file.
+ */
+bool EdgeFileReader::refill() {
+    if (file == nullptr) {
+        return false;
+    }
+    length = fread(buffer, 1, BUFFER_SIZE, file);
+    position = 0;
+    bytesRead += (long long) length;
+    return length > 0;
+}
+
+/**
+ * @brief Parses the next integer, skipping whitespace.
+ * @param value Output: the integer.
+ * @return False at the end of the file.
+ */
+bool EdgeFileReader::readInt(long long &value) {
+    while (true) {
+        if (position == length && !refill()) return false;
+        char c = buffer[position];
+        if (c == '-' || (c >= '0' && c <= '9')) break;
+        position++;
+    }
+    bool negative = buffer[position] == '-';
+    if (negative) position++;
+    value = 0;
+    while (true) {
+        if (position == length && !refill()) break;
+        char c = buffer[position];
+        if (c < '0' || c > '9') break;
+        value = value * 10 + (c - '0');
+        position++;
+    }
+    if (negative) value = -value;
+    return true;
+}
+
+/**
+ * @brief Reads the next edges.
+ * @param edges Output array.
+ * @param capacity The room in edges.
+ * @return The number of edges read; 0 at the end of the file.
+ */
+int EdgeFileReader::Read(Kruskal::Edge *edges, int capacity) {
+    int count = 0;
+    long long u, v, weight;
+    while (open && count < capacity && readInt(u) && readInt(v) && readInt(weight)) {
+        if (u < 0 || v < 0 || u >= numVertices || v >= numVertices) {
+            skippedEdges++;
+            continue;
+        }
+        edges[count++] = {(int) u, (int) v, (int) weight};
+    }
+    return count;
+}
+
+/**
+ * @brief Writes every undirected edge of an adjacency list once (src < dest) in the graph file format.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param path The path of the file to write.
+ * @return True on success.
+ */
+bool EdgeFileReader::WriteList(slistEl **adjList, int numVertices, const char *path) {
+    FILE* output = fopen(path, "w");
+    if (output == nullptr) {
+        return false;
+    }
+    long long numEdges = 0;
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            if (u < p->v) numEdges++;
+        }
+    }
+    fprintf(output, "%lld %d\n", numEdges, numVertices);
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            if (u < p->v) fprintf(output, "%d %d %d\n", u, p->v, p->weight);
+        }
+    }
+    return fclose(output) == 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file EdgeFileReader.h
+ * @brief This file contains the declaration of the EdgeFileReader class.
+ */
+
+#ifndef EDGEFILEREADER_H
+#define EDGEFILEREADER_H
+
+#include <cstdio>
+#include "../GraphsGenerating.h"
+#include "Kruskal.h"
+
+/**
+ * @class EdgeFileReader
+ * @brief Class reading an edge file in the graph file format ("E V" header, then "u v w" lines) in one pass.
+ *
+ * The file is read in large sequential chunks and parsed by hand, so edges can be streamed from files far larger
+ * than memory, or from standard input, without loading the graph. Edges with an end outside [0, V) are skipped.
+ */
+class EdgeFileReader {
+public:
+    /**
+     * @brief Opens an edge file and reads its header.
+     * @param path The path of the file, or "-" for standard input.
+     */
+    explicit EdgeFileReader(const char *path);
+
+    /**
+     * @brief Destructor for the EdgeFileReader class; closes the file.
+     */
+    ~EdgeFileReader();
+
+    EdgeFileReader(const EdgeFileReader &) = delete;
+    EdgeFileReader &operator=(const EdgeFileReader &) = delete;
+
+    /**
+     * @brief Checks whether the file was opened and its header read.
+     * @return True if edges can be read.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Returns the number of vertices declared in the header.
+     * @return The number of vertices.
+     */
+    int NumVertices() const;
+
+    /**
+     * @brief Returns the number of edges declared in the header.
+     * @return The number of edges; the file may actually hold a different number.
+     */
+    long long DeclaredEdges() const;
+
+    /**
+     * @brief Reads the next edges.
+     * @param edges Output array.
+     * @param capacity The room in edges.
+     * @return The number of edges read; 0 at the end of the file.
+     */
+    int Read(Kruskal::Edge *edges, int capacity);
+
+    /**
+     * @brief Returns the number of bytes read from the file so far.
+     * @return The number of bytes.
+     */
+    long long BytesRead() const;
+
+    /**
+     * @brief Returns the number of edges skipped because an end was out of range.
+     * @return The number of skipped edges.
+     */
+    long long SkippedEdges() const;
+
+    /**
+     * @brief Writes every undirected edge of an adjacency list once (src < dest) in the graph file format.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param path The path of the file to write.
+     * @return True on success.
+     */
+    static bool WriteList(slistEl **adjList, int numVertices, const char *path);
+
+    static const int BUFFER_SIZE = 1 << 20; ///< Bytes read from the file at a time
+
+private:
+    /**
+     * @brief Reads the next chunk of the file into the buffer.
+     * @return False at the end of the file.
+     */
+    bool refill();
+
+    /**
+     * @brief Parses the next integer, skipping whitespace.
+     * @param value Output: the integer.
+     * @return False at the end of the file.
+     */
+    bool readInt(long long &value);
+
+    FILE *file;
+    bool ownsFile; // False for standard input
+    char *buffer;
+    size_t position;
+    size_t length;
+    int numVertices;
+    long long declaredEdges;
+    long long bytesRead;
+    long long skippedEdges;
+    bool open;
+};
+
+#endif // EDGEFILEREADER_H
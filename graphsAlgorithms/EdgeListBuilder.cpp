@@ -0,0 +1,256 @@
+/**
+ * @file EdgeListBuilder.cpp
+ * @brief This file contains the implementation of the EdgeListBuilder class.
+ */
+
+#include "EdgeListBuilder.h"
+#include "EdgeSort.h"
+#include "Boruvka.h"
+#include "SSSPBatchRunner.h"
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+double EdgeListBuilder::lastExtractTime = 0;
+double EdgeListBuilder::lastSortTime = 0;
+bool EdgeListBuilder::lastReused = false;
+Kruskal::Edge* EdgeListBuilder::sorted = nullptr;
+int EdgeListBuilder::sortedCount = 0;
+slistEl** EdgeListBuilder::sortedSource = nullptr;
+unsigned long long EdgeListBuilder::sortedVersion = 0;
+
+/**
+ * @brief Runs job(0) .. job(numThreads - 1), one per thread, and waits for all of them.
+ * @param numThreads The number of threads.
+ * @param job The job, called with the thread index.
+ */
+template <typename Job>
+static void runThreads(int numThreads, const Job &job) {
+    vector<thread> pool;
+    for (int t = 1; t < numThreads; t++) {
+        pool.emplace_back(job, t);
+    }
+    job(0);
+    for (thread &t : pool) {
+        t.join();
+    }
+}
+
+/**
+ * @brief Copies per-thread buffers side by side into one new array.
+ * @param local The per-thread buffers.
+ * @param edgeCount Output: the total number of edges.
+ * @return The new array.
+ */
+static Kruskal::Edge* concatenate(vector<vector<Kruskal::Edge>> &local, int *edgeCount) {
+    int threads = (int) local.size();
+    vector<long long> offsets(threads + 1, 0);
+    for (int t = 0; t < threads; t++) {
+        offsets[t + 1] = offsets[t] + (long long) local[t].size();
+    }
+    *edgeCount = (int) offsets[threads];
+    Kruskal::Edge* edges = new Kruskal::Edge[*edgeCount > 0 ? *edgeCount : 1];
+    runThreads(threads, [&](int t) {
+        copy(local[t].begin(), local[t].end(), edges + offsets[t]);
+        vector<Kruskal::Edge>().swap(local[t]);
+    });
+    return edges;
+}
+
+/**
+ * @brief Collects every undirected edge of an adjacency list once (src < dest), in parallel.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param numThreads The number of threads; 0 uses the hardware concurrency.
+ * @param edgeCount Output: the number of edges.
+ * @return A new array of the edges, ordered by source vertex.
+ */
+Kruskal::Edge* EdgeListBuilder::FromList(slistEl **adjList, int numVertices, int numThreads, int *edgeCount) {
+    int threads = SSSPBatchRunner::ResolveThreads(numThreads);
+    vector<vector<Kruskal::Edge>> local(threads);
+    runThreads(threads, [&](int t) {
+        int lo = (int) ((long long) numVertices * t / threads);
+        int hi = (int) ((long long) numVertices * (t + 1) / threads);
+        for (int u = lo; u < hi; u++) {
+            for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+                if (u < p->v) {
+                    local[t].push_back({u, p->v, p->weight});
+                }
+            }
+        }
+    });
+    return concatenate(local, edgeCount);
+}
+
+/**
+ * @brief Collects the edges of an incidence matrix, in parallel.
+ *
+ * Every thread owns a range of columns and walks the matrix row by row over that range, so it reads each row
+ * segment sequentially instead of striding down the columns.
+ *
+ * @param incMatrix The incidence matrix representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param numEdges The number of edges (columns) in the matrix.
+ * @param numThreads The number of threads; 0 uses the hardware concurrency.
+ * @param edgeCount Output: the number of edges.
+ * @return A new array of the edges, ordered by column.
+ */
+Kruskal::Edge* EdgeListBuilder::FromMatrix(int **incMatrix, int numVertices, int numEdges, int numThreads,
+                                           int *edgeCount) {
+    int threads = SSSPBatchRunner::ResolveThreads(numThreads);
+    vector<vector<Kruskal::Edge>> local(threads);
+    runThreads(threads, [&](int t) {
+        int lo = (int) ((long long) numEdges * t / threads);
+        int hi = (int) ((long long) numEdges * (t + 1) / threads);
+        if (lo >= hi) return;
+        vector<Kruskal::Edge> ends(hi - lo, Kruskal::Edge{-1, -1, 0});
+        for (int i = 0; i < numVertices; i++) {
+            const int* row = incMatrix[i];
+            for (int e = lo; e < hi; e++) {
+                if (row[e] == 0) continue;
+                Kruskal::Edge &edge = ends[e - lo];
+                if (edge.src == -1) {
+                    edge.src = i;
+                    edge.weight = abs(row[e]);
+                } else if (edge.dest == -1) {
+                    edge.dest = i;
+                }
+            }
+        }
+        for (const Kruskal::Edge &edge : ends) {
+            if (edge.src != -1 && edge.dest != -1) {
+                local[t].push_back(edge);
+            }
+        }
+    });
+    return concatenate(local, edgeCount);
+}
+
+/**
+ * @brief Returns the edges of an adjacency list sorted by weight, building them only if the graph changed.
+ *
+ * The kept array is identified by the adjacency list pointer and GraphsGenerating::graphVersion, which every
+ * load, generation and mutation bumps.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param numThreads The number of threads; 0 uses the hardware concurrency.
+ * @param edgeCount Output: the number of edges.
+ * @return The sorted edges, owned by the builder and valid until the graph changes or Release is called.
+ */
+const Kruskal::Edge* EdgeListBuilder::SortedFromList(slistEl **adjList, int numVertices, int numThreads,
+                                                     int *edgeCount) {
+    lastReused = sorted != nullptr && sortedSource == adjList && sortedVersion == GraphsGenerating::graphVersion;
+    if (!lastReused) {
+        Release();
+        auto start = chrono::high_resolution_clock::now();
+        sorted = FromList(adjList, numVertices, numThreads, &sortedCount);
+        auto middle = chrono::high_resolution_clock::now();
+        Kruskal::lastSortStrategy = EdgeSort::Sort(sorted, sortedCount, Kruskal::sortStrategy, numThreads);
+        auto end = chrono::high_resolution_clock::now();
+        lastExtractTime = chrono::duration<double>(middle - start).count();
+        lastSortTime = chrono::duration<double>(end - middle).count();
+        sortedSource = adjList;
+        sortedVersion = GraphsGenerating::graphVersion;
+    }
+    *edgeCount = sortedCount;
+    return sorted;
+}
+
+/**
+ * @brief Frees the kept sorted array.
+ */
+void EdgeListBuilder::Release() {
+    delete[] sorted;
+    sorted = nullptr;
+    sortedCount = 0;
+    sortedSource = nullptr;
+}
+
+/**
+ * @brief Measures parallel extraction and sorting, then runs the MST variants on the shared sorted array.
+ *
+ * The first call builds the sorted array and later iterations reuse it, so the per-variant times show the cost
+ * of the MST step alone.
+ *
+ * @param incMatrix The incidence matrix representing the graph.
+ * @param adjList The adjacency list representing the same graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param numEdges The number of edges (columns) in the matrix.
+ */
+void EdgeListBuilder::TimeCounter(int **incMatrix, slistEl **adjList, int numVertices, int numEdges) {
+    cout << "Give number of threads (0 - all cores): ";
+    int numThreads;
+    cin >> numThreads;
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (iterations <= 0) {
+        return;
+    }
+
+    int matrixCount;
+    auto start = chrono::high_resolution_clock::now();
+    delete[] FromMatrix(incMatrix, numVertices, numEdges, 1, &matrixCount);
+    auto end = chrono::high_resolution_clock::now();
+    double serialMatrix = chrono::duration<double>(end - start).count();
+    start = chrono::high_resolution_clock::now();
+    delete[] FromMatrix(incMatrix, numVertices, numEdges, numThreads, &matrixCount);
+    end = chrono::high_resolution_clock::now();
+    double parallelMatrix = chrono::duration<double>(end - start).count();
+
+    start = chrono::high_resolution_clock::now();
+    int serialCount;
+    Kruskal::Edge* serial = FromList(adjList, numVertices, 1, &serialCount);
+    end = chrono::high_resolution_clock::now();
+    double serialExtract = chrono::duration<double>(end - start).count();
+    start = chrono::high_resolution_clock::now();
+    EdgeSort::Sort(serial, serialCount, Kruskal::sortStrategy, 1);
+    end = chrono::high_resolution_clock::now();
+    double serialSort = chrono::duration<double>(end - start).count();
+    delete[] serial;
+
+    Release();
+    int edgeCount;
+    const Kruskal::Edge* edges = SortedFromList(adjList, numVertices, numThreads, &edgeCount);
+    cout << "Edges: " << edgeCount << ", threads: " << SSSPBatchRunner::ResolveThreads(numThreads) << endl;
+    printf("%-12s %-14s %-14s\n", "Step", "1 thread [ms]", "Parallel [ms]");
+    printf("%-12s %-14.3f %-14.3f\n", "Matrix", serialMatrix * 1000, parallelMatrix * 1000);
+    printf("%-12s %-14.3f %-14.3f\n", "List", serialExtract * 1000, lastExtractTime * 1000);
+    printf("%-12s %-14.3f %-14.3f  (%s)\n", "Sort", serialSort * 1000, lastSortTime * 1000,
+           EdgeSort::StrategyName(Kruskal::lastSortStrategy));
+
+    double kruskalTime = 0, filterTime = 0, boruvkaTime = 0;
+    int kruskalWeight = 0, filterWeight = 0, boruvkaWeight = 0;
+    for (int i = 0; i < iterations; i++) {
+        edges = SortedFromList(adjList, numVertices, numThreads, &edgeCount);
+        start = chrono::high_resolution_clock::now();
+        kruskalWeight = Kruskal::AlgorithmCalculationFromEdges(edges, edgeCount, numVertices, true);
+        end = chrono::high_resolution_clock::now();
+        kruskalTime += chrono::duration<double>(end - start).count();
+
+        start = chrono::high_resolution_clock::now();
+        filterWeight = Kruskal::AlgorithmCalculationFromEdges(edges, edgeCount, numVertices, false);
+        end = chrono::high_resolution_clock::now();
+        filterTime += chrono::duration<double>(end - start).count();
+
+        start = chrono::high_resolution_clock::now();
+        boruvkaWeight = Boruvka::AlgorithmCalculationFromEdges(edges, edgeCount, numVertices, numThreads);
+        end = chrono::high_resolution_clock::now();
+        boruvkaTime += chrono::duration<double>(end - start).count();
+    }
+    cout << "MST steps on the shared array (" << (lastReused ? "reused" : "rebuilt") << "):" << endl;
+    printf("%-24s %-12.3f weight %d\n", "Kruskal (sorted scan)", kruskalTime / iterations * 1000, kruskalWeight);
+    printf("%-24s %-12.3f weight %d\n", "Filter-Kruskal", filterTime / iterations * 1000, filterWeight);
+    printf("%-24s %-12.3f weight %d\n", "Boruvka", boruvkaTime / iterations * 1000, boruvkaWeight);
+    if (kruskalWeight != filterWeight || kruskalWeight != boruvkaWeight) {
+        cout << "Tree weights differ between the variants" << endl;
+    }
+}
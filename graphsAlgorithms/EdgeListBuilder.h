@@ -0,0 +1,79 @@
+/**
+ * @file EdgeListBuilder.h
+ * @brief This file contains the declaration of the EdgeListBuilder class.
+ */
+
+#ifndef EDGELISTBUILDER_H
+#define EDGELISTBUILDER_H
+
+#include "../GraphsGenerating.h"
+#include "Kruskal.h"
+
+/**
+ * @class EdgeListBuilder
+ * @brief Class building the edge array of a graph in parallel and keeping a sorted copy for reuse.
+ *
+ * Extraction splits the vertices (adjacency list) or edge columns (incidence matrix) between threads. Each thread
+ * collects its edges into a local buffer, and the buffers are then copied side by side into one contiguous array.
+ * The sorted array is kept until the graph changes, so Kruskal, Filter-Kruskal and Boruvka runs on the same graph
+ * pay for extraction and sorting only once.
+ */
+class EdgeListBuilder {
+public:
+    /**
+     * @brief Collects every undirected edge of an adjacency list once (src < dest), in parallel.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param numThreads The number of threads; 0 uses the hardware concurrency.
+     * @param edgeCount Output: the number of edges.
+     * @return A new array of the edges, ordered by source vertex.
+     */
+    static Kruskal::Edge* FromList(slistEl **adjList, int numVertices, int numThreads, int *edgeCount);
+
+    /**
+     * @brief Collects the edges of an incidence matrix, in parallel.
+     * @param incMatrix The incidence matrix representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param numEdges The number of edges (columns) in the matrix.
+     * @param numThreads The number of threads; 0 uses the hardware concurrency.
+     * @param edgeCount Output: the number of edges.
+     * @return A new array of the edges, ordered by column.
+     */
+    static Kruskal::Edge* FromMatrix(int **incMatrix, int numVertices, int numEdges, int numThreads, int *edgeCount);
+
+    /**
+     * @brief Returns the edges of an adjacency list sorted by weight, building them only if the graph changed.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param numThreads The number of threads; 0 uses the hardware concurrency.
+     * @param edgeCount Output: the number of edges.
+     * @return The sorted edges, owned by the builder and valid until the graph changes or Release is called.
+     */
+    static const Kruskal::Edge* SortedFromList(slistEl **adjList, int numVertices, int numThreads, int *edgeCount);
+
+    /**
+     * @brief Frees the kept sorted array.
+     */
+    static void Release();
+
+    /**
+     * @brief Measures parallel extraction and sorting, then runs the MST variants on the shared sorted array.
+     * @param incMatrix The incidence matrix representing the graph.
+     * @param adjList The adjacency list representing the same graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param numEdges The number of edges (columns) in the matrix.
+     */
+    static void TimeCounter(int **incMatrix, slistEl **adjList, int numVertices, int numEdges);
+
+    static double lastExtractTime; ///< Extraction time of the last build, in seconds
+    static double lastSortTime; ///< Sort time of the last build, in seconds
+    static bool lastReused; ///< True if the last SortedFromList call returned the kept array
+
+private:
+    static Kruskal::Edge* sorted; // The kept sorted array
+    static int sortedCount;
+    static slistEl** sortedSource; // The adjacency list and graph version the kept array belongs to
+    static unsigned long long sortedVersion;
+};
+
+#endif // EDGELISTBUILDER_H
@@ -0,0 +1,358 @@
+/**
+ * @file EdgeSort.cpp
+ * @brief This file contains the implementation of the EdgeSort class.
+ */
+
+#include "EdgeSort.h"
+#include "SSSPBatchRunner.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Sorts edges by weight.
+ *
+ * AUTO_SORT uses the counting sort when the weight range is at most four times the number of edges (and at most
+ * COUNTING_RANGE), the sample sort when more than one thread is available for at least SAMPLE_MIN_EDGES edges,
+ * and the radix sort otherwise. The counting sort runs on several threads under the same size condition. An
+ * explicit counting sort over a range too wide for a count array falls back to the radix sort.
+ *
+ * @param edges The edges; sorted in place.
+ * @param count The number of edges.
+ * @param strategy The sort to use; AUTO_SORT picks one from the weight range, the size and the thread count.
+ * @param numThreads The number of threads for the sample and counting sorts; 0 uses the hardware concurrency.
+ * @return The strategy that was actually used.
+ */
+Kruskal::SortStrategy EdgeSort::Sort(Kruskal::Edge *edges, int count, Kruskal::SortStrategy strategy,
+                                     int numThreads) {
+    if (strategy == Kruskal::MERGE_SORT) {
+        MergeSort(edges, 0, count - 1);
+        return Kruskal::MERGE_SORT;
+    }
+    if (count <= 1) {
+        return strategy == Kruskal::AUTO_SORT ? Kruskal::COUNTING_SORT : strategy;
+    }
+
+    int minWeight = edges[0].weight, maxWeight = edges[0].weight;
+    for (int i = 1; i < count; i++) {
+        if (edges[i].weight < minWeight) minWeight = edges[i].weight;
+        if (edges[i].weight > maxWeight) maxWeight = edges[i].weight;
+    }
+    long long range = (long long) maxWeight - minWeight + 1;
+    int threads = SSSPBatchRunner::ResolveThreads(numThreads);
+
+    if (strategy == Kruskal::AUTO_SORT) {
+        if (range <= COUNTING_RANGE && range <= 4LL * count) {
+            strategy = Kruskal::COUNTING_SORT;
+        } else if (threads > 1 && count >= SAMPLE_MIN_EDGES) {
+            strategy = Kruskal::SAMPLE_SORT;
+        } else {
+            strategy = Kruskal::RADIX_SORT;
+        }
+    }
+    if (strategy == Kruskal::COUNTING_SORT && range > 256LL * COUNTING_RANGE) {
+        strategy = Kruskal::RADIX_SORT;
+    }
+
+    if (strategy == Kruskal::COUNTING_SORT && threads > 1 && count >= SAMPLE_MIN_EDGES && range <= COUNTING_RANGE) {
+        parallelCountingSort(edges, count, minWeight, maxWeight, threads);
+    } else if (strategy == Kruskal::COUNTING_SORT) {
+        countingSort(edges, count, minWeight, maxWeight);
+    } else if (strategy == Kruskal::SAMPLE_SORT) {
+        sampleSort(edges, count, threads);
+    } else {
+        radixSort(edges, count);
+    }
+    return strategy;
+}
+
+/**
+ * @brief Returns a printable name of a strategy.
+ * @param strategy The strategy.
+ * @return The name of the strategy.
+ */
+const char* EdgeSort::StrategyName(Kruskal::SortStrategy strategy) {
+    switch (strategy) {
+        case Kruskal::MERGE_SORT:
+            return "merge sort";
+        case Kruskal::COUNTING_SORT:
+            return "counting sort";
+        case Kruskal::RADIX_SORT:
+            return "LSD radix sort";
+        case Kruskal::SAMPLE_SORT:
+            return "parallel sample sort";
+        default:
+            return "automatic";
+    }
+}
+
+/**
+ * @brief Merges two subarrays of edges.
+ *
+ * @param edges The array of edges.
+ * @param left The left index.
+ * @param mid The middle index.
+ * @param right The right index.
+ */
+void EdgeSort::merge(Kruskal::Edge edges[], int left, int mid, int right) {
+    int n1 = mid - left + 1;
+    int n2 = right - mid;
+
+    Kruskal::Edge* L = new Kruskal::Edge[n1];
+    Kruskal::Edge* R = new Kruskal::Edge[n2];
+
+    for (int i = 0; i < n1; i++) {
+        L[i] = edges[left + i];
+    }
+    for (int j = 0; j < n2; j++) {
+        R[j] = edges[mid + 1 + j];
+    }
+
+    int i = 0, j = 0, k = left;
+    while (i < n1 && j < n2) {
+        if (L[i].weight <= R[j].weight) {
+            edges[k] = L[i];
+            i++;
+        } else {
+            edges[k] = R[j];
+            j++;
+        }
+        k++;
+    }
+
+    while (i < n1) {
+        edges[k] = L[i];
+        i++;
+        k++;
+    }
+
+    while (j < n2) {
+        edges[k] = R[j];
+        j++;
+        k++;
+    }
+
+    delete[] L;
+    delete[] R;
+}
+
+/**
+ * @brief Sorts edges using merge sort.
+ *
+ * @param edges The array of edges.
+ * @param left The left index.
+ * @param right The right index (inclusive).
+ */
+void EdgeSort::MergeSort(Kruskal::Edge edges[], int left, int right) {
+    if (left >= right) {
+        return;
+    }
+    int mid = left + (right - left) / 2;
+    MergeSort(edges, left, mid);
+    MergeSort(edges, mid + 1, right);
+    merge(edges, left, mid, right);
+}
+
+/**
+ * @brief Stable counting sort over the weight range [minWeight, maxWeight].
+ * @param edges The edges; sorted in place.
+ * @param count The number of edges.
+ * @param minWeight The smallest weight.
+ * @param maxWeight The largest weight.
+ */
+void EdgeSort::countingSort(Kruskal::Edge *edges, int count, int minWeight, int maxWeight) {
+    int range = maxWeight - minWeight + 1;
+    int* start = new int[range + 1]();
+    for (int i = 0; i < count; i++) {
+        start[edges[i].weight - minWeight + 1]++;
+    }
+    for (int w = 0; w < range; w++) {
+        start[w + 1] += start[w];
+    }
+    Kruskal::Edge* scratch = new Kruskal::Edge[count];
+    for (int i = 0; i < count; i++) {
+        scratch[start[edges[i].weight - minWeight]++] = edges[i];
+    }
+    memcpy(edges, scratch, sizeof(Kruskal::Edge) * count);
+    delete[] scratch;
+    delete[] start;
+}
+
+/**
+ * @brief Stable multi-threaded counting sort: per-thread histograms, one prefix sum, per-thread scatter.
+ *
+ * Every thread counts the weights of its contiguous chunk. The offsets are laid out weight by weight and, within
+ * one weight, thread by thread, so each thread scatters its chunk to disjoint positions and the order of equal
+ * weights is kept. The sorted edges are copied back in parallel.
+ *
+ * @param edges The edges; sorted in place.
+ * @param count The number of edges.
+ * @param minWeight The smallest weight.
+ * @param maxWeight The largest weight.
+ * @param numThreads The number of threads.
+ */
+void EdgeSort::parallelCountingSort(Kruskal::Edge *edges, int count, int minWeight, int maxWeight, int numThreads) {
+    int range = maxWeight - minWeight + 1;
+    vector<int> offsets((size_t) numThreads * range, 0);
+    auto chunkStart = [&](int t) { return (int) ((long long) count * t / numThreads); };
+    auto runAll = [&](auto job) {
+        vector<thread> pool;
+        for (int t = 1; t < numThreads; t++) {
+            pool.emplace_back(job, t);
+        }
+        job(0);
+        for (thread &t : pool) {
+            t.join();
+        }
+    };
+
+    runAll([&](int t) {
+        int* counts = &offsets[(size_t) t * range];
+        for (int i = chunkStart(t); i < chunkStart(t + 1); i++) {
+            counts[edges[i].weight - minWeight]++;
+        }
+    });
+    int position = 0;
+    for (int w = 0; w < range; w++) {
+        for (int t = 0; t < numThreads; t++) {
+            int size = offsets[(size_t) t * range + w];
+            offsets[(size_t) t * range + w] = position;
+            position += size;
+        }
+    }
+
+    Kruskal::Edge* scratch = new Kruskal::Edge[count];
+    runAll([&](int t) {
+        int* next = &offsets[(size_t) t * range];
+        for (int i = chunkStart(t); i < chunkStart(t + 1); i++) {
+            scratch[next[edges[i].weight - minWeight]++] = edges[i];
+        }
+    });
+    runAll([&](int t) {
+        copy(scratch + chunkStart(t), scratch + chunkStart(t + 1), edges + chunkStart(t));
+    });
+    delete[] scratch;
+}
+
+/**
+ * @brief Stable LSD radix sort over the weights, 8 bits per pass; passes over a constant digit are skipped.
+ *
+ * The sign bit is flipped so negative weights order correctly. All four digit histograms are built in one read
+ * of the input, and the passes alternate between the input and a single scratch buffer.
+ *
+ * @param edges The edges; sorted in place.
+ * @param count The number of edges.
+ */
+void EdgeSort::radixSort(Kruskal::Edge *edges, int count) {
+    int histogram[4][257] = {};
+    for (int i = 0; i < count; i++) {
+        uint32_t key = (uint32_t) edges[i].weight ^ 0x80000000u;
+        for (int d = 0; d < 4; d++) {
+            histogram[d][((key >> (8 * d)) & 0xFF) + 1]++;
+        }
+    }
+
+    Kruskal::Edge* scratch = new Kruskal::Edge[count];
+    Kruskal::Edge* from = edges;
+    Kruskal::Edge* to = scratch;
+    for (int d = 0; d < 4; d++) {
+        uint32_t firstDigit = (((uint32_t) edges[0].weight ^ 0x80000000u) >> (8 * d)) & 0xFF;
+        if (histogram[d][firstDigit + 1] == count) continue; // Every key has the same digit
+        int* start = histogram[d];
+        for (int b = 0; b < 256; b++) {
+            start[b + 1] += start[b];
+        }
+        for (int i = 0; i < count; i++) {
+            uint32_t digit = (((uint32_t) from[i].weight ^ 0x80000000u) >> (8 * d)) & 0xFF;
+            to[start[digit]++] = from[i];
+        }
+        swap(from, to);
+    }
+    if (from != edges) {
+        memcpy(edges, from, sizeof(Kruskal::Edge) * count);
+    }
+    delete[] scratch;
+}
+
+/**
+ * @brief Parallel sample sort: splitters from a sorted sample, per-thread bucket scatter, per-bucket sort.
+ *
+ * Every thread takes a contiguous chunk, counts how many of its edges fall in each of the numThreads buckets and
+ * scatters them into a scratch buffer at offsets from a prefix sum, so no two threads write the same slot. Each
+ * thread then sorts one bucket and copies it back. The sample is 32 weights per bucket, which keeps the bucket
+ * sizes close unless many edges share one weight.
+ *
+ * @param edges The edges; sorted in place.
+ * @param count The number of edges.
+ * @param numThreads The number of threads.
+ */
+void EdgeSort::sampleSort(Kruskal::Edge *edges, int count, int numThreads) {
+    int buckets = numThreads;
+    const int oversampling = 32;
+    vector<int> sample(buckets * oversampling);
+    uint32_t seed = 2463534242u;
+    for (int &w : sample) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        w = edges[seed % count].weight;
+    }
+    sort(sample.begin(), sample.end());
+    vector<int> splitters(buckets - 1);
+    for (int b = 0; b < buckets - 1; b++) {
+        splitters[b] = sample[(b + 1) * oversampling];
+    }
+    auto bucketOf = [&](int weight) {
+        return (int) (upper_bound(splitters.begin(), splitters.end(), weight) - splitters.begin());
+    };
+
+    vector<int> offsets((size_t) numThreads * buckets, 0);
+    auto chunkStart = [&](int t) { return (int) ((long long) count * t / numThreads); };
+    auto runAll = [&](auto job) {
+        vector<thread> pool;
+        for (int t = 1; t < numThreads; t++) {
+            pool.emplace_back(job, t);
+        }
+        job(0);
+        for (thread &t : pool) {
+            t.join();
+        }
+    };
+
+    runAll([&](int t) {
+        int* counts = &offsets[(size_t) t * buckets];
+        for (int i = chunkStart(t); i < chunkStart(t + 1); i++) {
+            counts[bucketOf(edges[i].weight)]++;
+        }
+    });
+    vector<int> bucketStart(buckets + 1, 0);
+    int position = 0;
+    for (int b = 0; b < buckets; b++) {
+        bucketStart[b] = position;
+        for (int t = 0; t < numThreads; t++) {
+            int size = offsets[(size_t) t * buckets + b];
+            offsets[(size_t) t * buckets + b] = position;
+            position += size;
+        }
+    }
+    bucketStart[buckets] = position;
+
+    Kruskal::Edge* scratch = new Kruskal::Edge[count];
+    runAll([&](int t) {
+        int* next = &offsets[(size_t) t * buckets];
+        for (int i = chunkStart(t); i < chunkStart(t + 1); i++) {
+            scratch[next[bucketOf(edges[i].weight)]++] = edges[i];
+        }
+    });
+    runAll([&](int b) {
+        Kruskal::Edge* first = scratch + bucketStart[b];
+        Kruskal::Edge* last = scratch + bucketStart[b + 1];
+        sort(first, last, [](const Kruskal::Edge &x, const Kruskal::Edge &y) { return x.weight < y.weight; });
+        copy(first, last, edges + bucketStart[b]);
+    });
+    delete[] scratch;
+}
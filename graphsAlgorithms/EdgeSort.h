@@ -0,0 +1,82 @@
+/**
+ * @file EdgeSort.h
+ * @brief This file contains the declaration of the EdgeSort class.
+ */
+
+#ifndef EDGESORT_H
+#define EDGESORT_H
+
+#include "Kruskal.h"
+
+/**
+ * @class EdgeSort
+ * @brief Class collecting the strategies for sorting edges by weight before Kruskal's algorithm.
+ *
+ * Besides the original top-down merge sort, the edges can be ordered by a counting sort (narrow weight ranges,
+ * such as the 1..50 weights of generated graphs), an LSD radix sort over the 32-bit weight, or a parallel sample
+ * sort for wide ranges on many cores. Counting and radix sort need one scratch buffer of the same size as the
+ * input, allocated once per call. Large inputs with a narrow range are counted and scattered by several threads.
+ */
+class EdgeSort {
+public:
+    /**
+     * @brief Sorts edges by weight.
+     * @param edges The edges; sorted in place.
+     * @param count The number of edges.
+     * @param strategy The sort to use; AUTO_SORT picks one from the weight range, the size and the thread count.
+     * @param numThreads The number of threads for the sample and counting sorts; 0 uses the hardware concurrency.
+     * @return The strategy that was actually used.
+     */
+    static Kruskal::SortStrategy Sort(Kruskal::Edge *edges, int count, Kruskal::SortStrategy strategy,
+                                      int numThreads = 0);
+
+    /**
+     * @brief Returns a printable name of a strategy.
+     * @param strategy The strategy.
+     * @return The name of the strategy.
+     */
+    static const char* StrategyName(Kruskal::SortStrategy strategy);
+
+    /**
+     * @brief Sorts edges[left..right] by weight using merge sort.
+     * @param edges The array of edges.
+     * @param left The left index.
+     * @param right The right index (inclusive).
+     */
+    static void MergeSort(Kruskal::Edge edges[], int left, int right);
+
+private:
+    /**
+     * @brief Merges two sorted subarrays of edges.
+     * @param edges The array of edges.
+     * @param left The left index.
+     * @param mid The middle index.
+     * @param right The right index.
+     */
+    static void merge(Kruskal::Edge edges[], int left, int mid, int right);
+
+    /**
+     * @brief Stable counting sort over the weight range [minWeight, maxWeight].
+     */
+    static void countingSort(Kruskal::Edge *edges, int count, int minWeight, int maxWeight);
+
+    /**
+     * @brief Stable multi-threaded counting sort: per-thread histograms, one prefix sum, per-thread scatter.
+     */
+    static void parallelCountingSort(Kruskal::Edge *edges, int count, int minWeight, int maxWeight, int numThreads);
+
+    /**
+     * @brief Stable LSD radix sort over the weights, 8 bits per pass; passes over a constant digit are skipped.
+     */
+    static void radixSort(Kruskal::Edge *edges, int count);
+
+    /**
+     * @brief Parallel sample sort: splitters from a sorted sample, per-thread bucket scatter, per-bucket sort.
+     */
+    static void sampleSort(Kruskal::Edge *edges, int count, int numThreads);
+
+    static const int COUNTING_RANGE = 1 << 16; // Widest weight range AUTO_SORT hands to the counting sort
+    static const int SAMPLE_MIN_EDGES = 1 << 16; // Fewest edges for which the sorts start threads
+};
+
+#endif // EDGESORT_H
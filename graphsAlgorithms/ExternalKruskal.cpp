@@ -0,0 +1,445 @@
+/**
+ * @file ExternalKruskal.cpp
+ * @brief This file contains the implementation of the ExternalKruskal class.
+ */
+
+#include "ExternalKruskal.h"
+#include "ConcurrentUnionFind.h"
+#include "EdgeSort.h"
+#include "StreamingMST.h"
+#include <iostream>
+#include <cstdio>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <deque>
+#include <queue>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <filesystem>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define EXTERNAL_KRUSKAL_PID 1
+#include <unistd.h>
+#else
+#define EXTERNAL_KRUSKAL_PID 0
+#include <random>
+#endif
+
+using namespace std;
+
+Kruskal::Edge* ExternalKruskal::mst = nullptr;
+int ExternalKruskal::mstSize = 0;
+long long ExternalKruskal::lastEdges = 0;
+int ExternalKruskal::lastRuns = 0;
+long long ExternalKruskal::lastBytesWritten = 0;
+long long ExternalKruskal::lastEdgesMerged = 0;
+double ExternalKruskal::lastRunPhaseTime = 0;
+double ExternalKruskal::lastMergePhaseTime = 0;
+int ExternalKruskal::lastMergePasses = 0;
+
+/**
+ * @class BufferQueue
+ * @brief Blocking queue of (buffer, edge count) pairs handed between the I/O thread and the calling thread.
+ */
+class BufferQueue {
+public:
+    /**
+     * @brief Hands a buffer over; a negative buffer index asks the other side to stop.
+     * @param buffer The buffer index.
+     * @param count The number of edges in the buffer.
+     */
+    void Push(int buffer, int count) {
+        {
+            lock_guard<mutex> lock(guard);
+            items.push_back({buffer, count});
+        }
+        available.notify_one();
+    }
+
+    /**
+     * @brief Waits for the next buffer.
+     * @return The buffer index and the number of edges in it.
+     */
+    pair<int, int> Pop() {
+        unique_lock<mutex> lock(guard);
+        available.wait(lock, [this] { return !items.empty(); });
+        pair<int, int> item = items.front();
+        items.pop_front();
+        return item;
+    }
+
+private:
+    mutex guard;
+    condition_variable available;
+    deque<pair<int, int>> items;
+};
+
+/**
+ * @class RunMerger
+ * @brief K-way merge of sorted run files through one read block per run and a heap of the run heads.
+ */
+class RunMerger {
+public:
+    /**
+     * @brief Reads the first block of every run.
+     * @param files The open run files; they stay owned by the caller.
+     * @param blockEdges The number of edges read from a run at a time.
+     */
+    RunMerger(const vector<FILE*> &files, int blockEdges)
+        : files(files), blocks(files.size()), position(files.size(), 0), length(files.size(), 0),
+          blockEdges(blockEdges) {
+        for (int r = 0; r < (int) files.size(); r++) {
+            blocks[r] = new Kruskal::Edge[blockEdges];
+            if (refill(r)) heads.push({blocks[r][0].weight, r});
+        }
+    }
+
+    /**
+     * @brief Destructor for the RunMerger class.
+     */
+    ~RunMerger() {
+        for (Kruskal::Edge* block : blocks) {
+            delete[] block;
+        }
+    }
+
+    RunMerger(const RunMerger &) = delete;
+    RunMerger &operator=(const RunMerger &) = delete;
+
+    /**
+     * @brief Takes the next edges in weight order.
+     * @param output Output array.
+     * @param capacity The room in output.
+     * @return The number of edges written, 0 once every run is exhausted.
+     */
+    int Next(Kruskal::Edge *output, int capacity) {
+        int count = 0;
+        while (count < capacity && !heads.empty()) {
+            int r = heads.top().second;
+            heads.pop();
+            output[count++] = blocks[r][position[r]++];
+            if (position[r] < length[r] || refill(r)) {
+                heads.push({blocks[r][position[r]].weight, r});
+            }
+        }
+        return count;
+    }
+
+private:
+    /**
+     * @brief Reads the next block of a run.
+     * @param r The run.
+     * @return True if the block is not empty.
+     */
+    bool refill(int r) {
+        length[r] = (int) fread(blocks[r], sizeof(Kruskal::Edge), blockEdges, files[r]);
+        position[r] = 0;
+        return length[r] > 0;
+    }
+
+    typedef pair<int, int> Head; // (weight, run)
+    vector<FILE*> files;
+    vector<Kruskal::Edge*> blocks;
+    vector<int> position;
+    vector<int> length;
+    int blockEdges;
+    priority_queue<Head, vector<Head>, greater<Head>> heads;
+};
+
+/**
+ * @brief Opens run files for reading.
+ * @param paths The paths of the runs.
+ * @param files Output: the open files, in the order of paths.
+ * @return True if every file was opened; on failure no file is left open.
+ */
+static bool openRuns(const vector<string> &paths, vector<FILE*> &files) {
+    files.clear();
+    for (const string &path : paths) {
+        FILE* file = fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            for (FILE* open : files) {
+                fclose(open);
+            }
+            files.clear();
+            return false;
+        }
+        files.push_back(file);
+    }
+    return true;
+}
+
+/**
+ * @brief Returns a name for the run directory that is unique to this process.
+ * @return The directory name.
+ */
+static string runDirectoryName() {
+#if EXTERNAL_KRUSKAL_PID
+    return "graph_efficiency_runs_" + to_string(getpid());
+#else
+    random_device device;
+    return "graph_efficiency_runs_" + to_string(device()) + "_" + to_string(device());
+#endif
+}
+
+/**
+ * @brief Computes the minimum spanning forest of all edges left in a reader.
+ *
+ * Run formation: the I/O thread parses the input into one of two run buffers while the calling thread sorts the
+ * other one and writes it out. Each buffer takes a third of the budget; the sort scratch takes the last third.
+ *
+ * Merge: the I/O thread keeps one read block per run and a heap of the run heads, and fills one of two output
+ * batches at a time; the calling thread feeds the other batch to the union-find. When the tree is complete the
+ * I/O thread is told to stop, so the heavy tail of the runs is never read. If the runs need more read blocks than
+ * the budget holds, groups of them are first merged into longer runs, one pass at a time.
+ *
+ * @param reader The open edge file.
+ * @param memoryBytes The memory budget for edge buffers; the O(V) union-find and tree come on top.
+ * @param tempDirectory The directory for the run files, or nullptr for the system temporary directory.
+ * @return The total weight of the forest, or -1 if the run files cannot be written or read back.
+ */
+long long ExternalKruskal::AlgorithmCalculationFromFile(EdgeFileReader &reader, size_t memoryBytes,
+                                                        const char *tempDirectory) {
+    int numVertices = reader.NumVertices();
+    lastEdges = 0;
+    lastRuns = 0;
+    lastBytesWritten = 0;
+    lastEdgesMerged = 0;
+    lastRunPhaseTime = 0;
+    lastMergePhaseTime = 0;
+    lastMergePasses = 0;
+    delete[] mst;
+    mst = new Kruskal::Edge[numVertices > 1 ? numVertices - 1 : 1];
+    mstSize = 0;
+
+    error_code error;
+    filesystem::path base = tempDirectory != nullptr ? filesystem::path(tempDirectory)
+                                                     : filesystem::temp_directory_path(error);
+    filesystem::path directory = base / runDirectoryName();
+    filesystem::create_directories(directory, error);
+    if (error) {
+        return -1;
+    }
+    auto runPath = [&](int run) { return (directory / ("run_" + to_string(run) + ".bin")).string(); };
+
+    // Phase 1: sorted runs
+    auto start = chrono::high_resolution_clock::now();
+    size_t budgetEdges = memoryBytes / (3 * sizeof(Kruskal::Edge));
+    int runEdges = (int) (budgetEdges < (size_t) MIN_RUN_EDGES ? MIN_RUN_EDGES
+                          : budgetEdges > (size_t) (1 << 28) ? (1 << 28) : budgetEdges);
+    Kruskal::Edge* runBuffers[2] = {new Kruskal::Edge[runEdges], new Kruskal::Edge[runEdges]};
+    BufferQueue emptyBuffers, fullBuffers;
+    emptyBuffers.Push(0, 0);
+    emptyBuffers.Push(1, 0);
+    thread parser([&] {
+        while (true) {
+            pair<int, int> slot = emptyBuffers.Pop();
+            if (slot.first < 0) return;
+            int count = reader.Read(runBuffers[slot.first], runEdges);
+            fullBuffers.Push(slot.first, count);
+            if (count == 0) return;
+        }
+    });
+    bool failed = false;
+    while (true) {
+        pair<int, int> slot = fullBuffers.Pop();
+        if (slot.second == 0) break;
+        Kruskal::Edge* run = runBuffers[slot.first];
+        EdgeSort::Sort(run, slot.second, Kruskal::sortStrategy);
+        FILE* output = fopen(runPath(lastRuns).c_str(), "wb");
+        size_t written = output != nullptr ? fwrite(run, sizeof(Kruskal::Edge), slot.second, output) : 0;
+        if (output == nullptr || fclose(output) != 0 || written != (size_t) slot.second) {
+            failed = true;
+            emptyBuffers.Push(-1, 0);
+            break;
+        }
+        lastRuns++;
+        lastEdges += slot.second;
+        lastBytesWritten += (long long) written * (long long) sizeof(Kruskal::Edge);
+        emptyBuffers.Push(slot.first, 0);
+    }
+    parser.join();
+    delete[] runBuffers[0];
+    delete[] runBuffers[1];
+    lastRunPhaseTime = chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    if (failed) {
+        filesystem::remove_all(directory, error);
+        return -1;
+    }
+
+    // Phase 2: k-way merge into the union-find, after intermediate passes if the runs need more blocks than fit
+    start = chrono::high_resolution_clock::now();
+    size_t budgetBlocks = memoryBytes / (sizeof(Kruskal::Edge) * (size_t) MIN_BLOCK_EDGES);
+    int fanIn = budgetBlocks < (size_t) MIN_FAN_IN + 2 ? MIN_FAN_IN
+                : budgetBlocks > (size_t) MAX_FAN_IN + 2 ? MAX_FAN_IN : (int) budgetBlocks - 2;
+    int mergeWidth = lastRuns < fanIn ? lastRuns : fanIn;
+    size_t blockBudget = memoryBytes / (sizeof(Kruskal::Edge) * (size_t) (mergeWidth + 2));
+    int blockEdges = (int) (blockBudget < (size_t) MIN_BLOCK_EDGES ? MIN_BLOCK_EDGES
+                            : blockBudget > (size_t) (1 << 24) ? (1 << 24) : blockBudget);
+
+    vector<int> runIds;
+    for (int r = 0; r < lastRuns; r++) {
+        runIds.push_back(r);
+    }
+    int nextRun = lastRuns;
+    vector<FILE*> files;
+    while ((int) runIds.size() > fanIn) {
+        lastMergePasses++;
+        vector<int> merged;
+        Kruskal::Edge* output = new Kruskal::Edge[blockEdges];
+        for (size_t first = 0; first < runIds.size() && !failed; first += fanIn) {
+            size_t last = first + fanIn < runIds.size() ? first + fanIn : runIds.size();
+            if (last - first == 1) {
+                merged.push_back(runIds[first]);
+                continue;
+            }
+            vector<string> paths;
+            for (size_t i = first; i < last; i++) {
+                paths.push_back(runPath(runIds[i]));
+            }
+            FILE* target = fopen(runPath(nextRun).c_str(), "wb");
+            if (target == nullptr || !openRuns(paths, files)) {
+                if (target != nullptr) fclose(target);
+                failed = true;
+                break;
+            }
+            RunMerger merger(files, blockEdges);
+            int count;
+            while (!failed && (count = merger.Next(output, blockEdges)) > 0) {
+                if (fwrite(output, sizeof(Kruskal::Edge), count, target) != (size_t) count) {
+                    failed = true;
+                }
+                lastBytesWritten += (long long) count * (long long) sizeof(Kruskal::Edge);
+            }
+            for (FILE* file : files) {
+                fclose(file);
+            }
+            if (fclose(target) != 0) {
+                failed = true;
+            }
+            for (const string &path : paths) {
+                filesystem::remove(path, error);
+            }
+            merged.push_back(nextRun++);
+        }
+        delete[] output;
+        if (failed) break;
+        runIds = merged;
+    }
+    vector<string> finalPaths;
+    for (int id : runIds) {
+        finalPaths.push_back(runPath(id));
+    }
+    if (failed || !openRuns(finalPaths, files)) {
+        filesystem::remove_all(directory, error);
+        return -1;
+    }
+
+    Kruskal::Edge* batches[2] = {new Kruskal::Edge[blockEdges], new Kruskal::Edge[blockEdges]};
+    BufferQueue emptyBatches, fullBatches;
+    emptyBatches.Push(0, 0);
+    emptyBatches.Push(1, 0);
+    thread merger([&] {
+        RunMerger runs(files, blockEdges);
+        while (true) {
+            pair<int, int> slot = emptyBatches.Pop();
+            if (slot.first < 0) break;
+            int count = runs.Next(batches[slot.first], blockEdges);
+            fullBatches.Push(slot.first, count);
+            if (count == 0) break;
+        }
+    });
+
+    ConcurrentUnionFind components(numVertices);
+    int treeEdges = numVertices > 1 ? numVertices - 1 : 0;
+    long long mstWeight = 0;
+    while (true) {
+        pair<int, int> slot = fullBatches.Pop();
+        if (slot.second == 0) break;
+        Kruskal::Edge* batch = batches[slot.first];
+        for (int i = 0; i < slot.second && mstSize < treeEdges; i++) {
+            lastEdgesMerged++;
+            if (components.UniteSequential(batch[i].src, batch[i].dest)) {
+                mst[mstSize++] = batch[i];
+                mstWeight += batch[i].weight;
+            }
+        }
+        if (mstSize == treeEdges) {
+            emptyBatches.Push(-1, 0);
+            break;
+        }
+        emptyBatches.Push(slot.first, 0);
+    }
+    merger.join();
+    for (FILE* file : files) {
+        fclose(file);
+    }
+    delete[] batches[0];
+    delete[] batches[1];
+    filesystem::remove_all(directory, error);
+    lastMergePhaseTime = chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    return mstWeight;
+}
+
+/**
+ * @brief Runs the external Kruskal on an edge file (or the loaded graph through a temporary file) and reports I/O.
+ *
+ * With the path "current" the loaded graph is written to a file in the system temporary directory first, and
+ * the result is checked against Kruskal's algorithm on the adjacency list.
+ *
+ * @param adjList The adjacency list of the loaded graph, used when the path is "current".
+ * @param numVertices The number of vertices of the loaded graph.
+ */
+void ExternalKruskal::TimeCounterFile(slistEl **adjList, int numVertices) {
+    cout << "Give the path of the edge file (- for standard input, current for the loaded graph): ";
+    string path;
+    cin >> path;
+    cout << "Give the memory budget in MB: ";
+    double megabytes;
+    cin >> megabytes;
+    cout << endl;
+
+    bool current = path == "current";
+    if (current) {
+        path = (filesystem::temp_directory_path() / "graph_efficiency_edges.txt").string();
+        if (!EdgeFileReader::WriteList(adjList, numVertices, path.c_str())) {
+            cout << "Cannot write " << path << endl;
+            return;
+        }
+    }
+
+    EdgeFileReader reader(path.c_str());
+    if (!reader.IsOpen()) {
+        cout << "Cannot open the file" << endl;
+        return;
+    }
+    long long mstWeight = AlgorithmCalculationFromFile(reader, (size_t) (megabytes > 0 ? megabytes * 1e6 : 0));
+    if (mstWeight < 0) {
+        cout << "Cannot write or read back the run files" << endl;
+        return;
+    }
+
+    printf("Edges: %lld, sorted runs: %d, run files: %.2f MB\n", lastEdges, lastRuns, lastBytesWritten / 1e6);
+    printf("Run formation: %.3f ms (%.1f MB/s of input, %.1f MB/s written)\n", lastRunPhaseTime * 1000,
+           lastRunPhaseTime > 0 ? reader.BytesRead() / lastRunPhaseTime / 1e6 : 0.0,
+           lastRunPhaseTime > 0 ? lastBytesWritten / lastRunPhaseTime / 1e6 : 0.0);
+    printf("Merge: %.3f ms, %d intermediate passes, %lld of %lld edges merged before the tree was complete\n",
+           lastMergePhaseTime * 1000, lastMergePasses, lastEdgesMerged, lastEdges);
+    printf("Forest: %d edges, weight %lld\n", mstSize, mstWeight);
+    if (StreamingMST::PeakResidentBytes() > 0) {
+        printf("Process peak resident memory: %.2f MB\n", StreamingMST::PeakResidentBytes() / 1e6);
+    }
+
+    if (current) {
+        Kruskal::AlgorithmCalculationFromList(adjList, numVertices);
+        long long expected = 0;
+        for (int i = 0; i < Kruskal::mstSize; i++) {
+            expected += Kruskal::mst[i].weight;
+        }
+        cout << "Kruskal on the loaded graph: weight " << expected
+             << (expected == mstWeight ? " (matches)" : " (differs)") << endl;
+        remove(path.c_str());
+    }
+}
@@ -0,0 +1,60 @@
+/**
+ * @file ExternalKruskal.h
+ * @brief This file contains the declaration of the ExternalKruskal class.
+ */
+
+#ifndef EXTERNALKRUSKAL_H
+#define EXTERNALKRUSKAL_H
+
+#include <cstddef>
+#include "Kruskal.h"
+#include "EdgeFileReader.h"
+
+/**
+ * @class ExternalKruskal
+ * @brief Class implementing Kruskal's algorithm for edge lists larger than memory, sorting them on disk.
+ *
+ * The edges are cut into runs that fit the memory budget; every run is sorted by weight and written to a binary
+ * file in one sequential write. A k-way merge then reads the runs in large blocks and feeds the edges, in weight
+ * order, to a union-find that needs only O(V) memory, stopping as soon as the tree has V - 1 edges. The fan-in of
+ * the merge is limited by the budget; with more runs, intermediate passes merge groups of them first. In both
+ * phases a second thread does the file I/O (parsing the input, merging the runs) while the calling thread sorts
+ * or runs the union-find, with edge batches handed over through two buffers.
+ */
+class ExternalKruskal {
+public:
+    /**
+     * @brief Computes the minimum spanning forest of all edges left in a reader.
+     * @param reader The open edge file.
+     * @param memoryBytes The memory budget for edge buffers; the O(V) union-find and tree come on top.
+     * @param tempDirectory The directory for the run files, or nullptr for the system temporary directory.
+     * @return The total weight of the forest, or -1 if the run files cannot be written or read back.
+     */
+    static long long AlgorithmCalculationFromFile(EdgeFileReader &reader, size_t memoryBytes,
+                                                  const char *tempDirectory = nullptr);
+
+    /**
+     * @brief Runs the external Kruskal on an edge file (or the loaded graph through a temporary file) and reports I/O.
+     * @param adjList The adjacency list of the loaded graph, used when the path is "current".
+     * @param numVertices The number of vertices of the loaded graph.
+     */
+    static void TimeCounterFile(slistEl **adjList, int numVertices);
+
+    static Kruskal::Edge* mst; ///< The resulting forest
+    static int mstSize; ///< The number of edges in mst
+    static long long lastEdges; ///< Edges read by the last run
+    static int lastRuns; ///< Sorted runs written by the last run
+    static long long lastBytesWritten; ///< Bytes written to run files by the last run
+    static long long lastEdgesMerged; ///< Edges taken from the merge before the tree was complete
+    static double lastRunPhaseTime; ///< Time spent reading, sorting and writing runs, in seconds
+    static double lastMergePhaseTime; ///< Time spent merging the runs into the union-find, in seconds
+    static int lastMergePasses; ///< Intermediate merge passes needed to bring the runs down to the fan-in
+
+private:
+    static const int MIN_RUN_EDGES = 1 << 16; // Smallest run, whatever the budget
+    static const int MIN_BLOCK_EDGES = 1 << 12; // Smallest read block per run in the merge
+    static const int MIN_FAN_IN = 2; // Fewest runs merged at once, whatever the budget
+    static const int MAX_FAN_IN = 1 << 10; // Most runs merged at once, which bounds the open files
+};
+
+#endif // EXTERNALKRUSKAL_H
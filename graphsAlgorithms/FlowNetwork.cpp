@@ -0,0 +1,103 @@
+/**
+ * @file FlowNetwork.cpp
+ * @brief This file contains the implementation of the FlowNetwork class.
+ */
+
+#include "FlowNetwork.h"
+
+/**
+ * @brief Builds the residual network of an adjacency list.
+ *
+ * Rows are filled by a counting pass followed by a placement pass, as in CsrGraph; every edge is counted in the
+ * row of its tail and in the row of its head, and both arcs are placed at once so the mates are known directly.
+ *
+ * @param adjList The adjacency list representing the graph; edge weights are the capacities.
+ * @param numVertices The number of vertices in the graph.
+ */
+FlowNetwork::FlowNetwork(slistEl **adjList, int numVertices) {
+    this->numVertices = numVertices;
+    offsets = new int[numVertices + 1]();
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            if (p->v == u) continue;
+            offsets[u + 1]++;
+            offsets[p->v + 1]++;
+        }
+    }
+    for (int u = 0; u < numVertices; u++) {
+        offsets[u + 1] += offsets[u];
+    }
+    numArcs = offsets[numVertices];
+    heads = new int[numArcs > 0 ? numArcs : 1];
+    mates = new int[numArcs > 0 ? numArcs : 1];
+    capacity = new int[numArcs > 0 ? numArcs : 1];
+    residual = new int[numArcs > 0 ? numArcs : 1];
+
+    int* fill = new int[numVertices];
+    for (int u = 0; u < numVertices; u++) {
+        fill[u] = offsets[u];
+    }
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            int v = p->v;
+            if (v == u) continue;
+            int forward = fill[u]++;
+            int backward = fill[v]++;
+            heads[forward] = v;
+            heads[backward] = u;
+            mates[forward] = backward;
+            mates[backward] = forward;
+            capacity[forward] = p->weight > 0 ? p->weight : 0;
+            capacity[backward] = 0;
+        }
+    }
+    delete[] fill;
+    Reset();
+}
+
+/**
+ * @brief Destructor for the FlowNetwork class.
+ */
+FlowNetwork::~FlowNetwork() {
+    delete[] offsets;
+    delete[] heads;
+    delete[] mates;
+    delete[] capacity;
+    delete[] residual;
+}
+
+/**
+ * @brief Removes all flow, restoring every residual capacity to the original capacity.
+ */
+void FlowNetwork::Reset() {
+    for (int a = 0; a < numArcs; a++) {
+        residual[a] = capacity[a];
+    }
+}
+
+/**
+ * @brief Marks the vertices reachable from the source in the residual network.
+ * @param source The source vertex.
+ * @param sourceSide Output array of numVertices flags; after a maximum flow it is the source side of a minimum cut.
+ * @return The number of marked vertices.
+ */
+int FlowNetwork::SourceSide(int source, bool *sourceSide) const {
+    for (int v = 0; v < numVertices; v++) {
+        sourceSide[v] = false;
+    }
+    int* queue = new int[numVertices];
+    int front = 0, back = 0;
+    queue[back++] = source;
+    sourceSide[source] = true;
+    while (front != back) {
+        int u = queue[front++];
+        for (int a = offsets[u]; a < offsets[u + 1]; a++) {
+            if (residual[a] > 0 && !sourceSide[heads[a]]) {
+                sourceSide[heads[a]] = true;
+                queue[back++] = heads[a];
+            }
+        }
+    }
+    delete[] queue;
+    return back;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file FlowNetwork.h
+ * @brief This file contains the declaration of the FlowNetwork class.
+ */
+
+#ifndef FLOWNETWORK_H
+#define FLOWNETWORK_H
+
+#include "../GraphsGenerating.h"
+
+/**
+ * @class FlowNetwork
+ * @brief Class storing a flow network as a residual graph in compressed sparse row form with paired arcs.
+ *
+ * Every edge (u, v) of the adjacency list becomes an arc u -> v with the edge weight as capacity and a paired arc
+ * v -> u with capacity 0; mates links the two. The arcs leaving u are heads[offsets[u]] .. heads[offsets[u + 1] - 1],
+ * so a max-flow algorithm scans contiguous memory and pushes flow by moving residual capacity between an arc and
+ * its mate. Self-loops are dropped.
+ */
+class FlowNetwork {
+public:
+    /**
+     * @brief Builds the residual network of an adjacency list.
+     * @param adjList The adjacency list representing the graph; edge weights are the capacities.
+     * @param numVertices The number of vertices in the graph.
+     */
+    FlowNetwork(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Destructor for the FlowNetwork class.
+     */
+    ~FlowNetwork();
+
+    FlowNetwork(const FlowNetwork &) = delete;
+    FlowNetwork &operator=(const FlowNetwork &) = delete;
+
+    /**
+     * @brief Removes all flow, restoring every residual capacity to the original capacity.
+     */
+    void Reset();
+
+    /**
+     * @brief Marks the vertices reachable from the source in the residual network.
+     * @param source The source vertex.
+     * @param sourceSide Output array of numVertices flags; after a maximum flow it is the source side of a minimum cut.
+     * @return The number of marked vertices.
+     */
+    int SourceSide(int source, bool *sourceSide) const;
+
+    int numVertices; ///< The number of vertices
+    int numArcs; ///< The number of arcs, twice the number of edges
+    int *offsets; ///< numVertices + 1 row offsets into the arc arrays
+    int *heads; ///< Arc heads
+    int *mates; ///< Index of the paired reverse arc
+    int *capacity; ///< Original arc capacities, 0 for the reverse arcs
+    int *residual; ///< Residual arc capacities
+};
+
+#endif // FLOWNETWORK_H
@@ -0,0 +1,231 @@
+/**
+ * @file FloydWarshall.cpp
+ * @brief This file contains the implementation of the FloydWarshall class.
+ */
+
+#include "FloydWarshall.h"
+#include "CsrGraph.h"
+#include "SSSPBatchRunner.h"
+#include "SimdKernels.h"
+#include "ThreadBarrier.h"
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <atomic>
+
+using namespace std;
+
+/**
+ * @brief Computes all shortest path distances and the next-hop matrix.
+ *
+ * Unreachable pairs are INF while the kernel runs and become INT_MAX at the end; an entry that is only reachable
+ * through INF (above INF / 2) is treated as unreachable too, since a negative edge can pull INF slightly down.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param numThreads The number of threads; 0 uses the hardware concurrency.
+ * @param dist Output matrix of distances (INT_MAX marks unreachable pairs); it must be kept in memory.
+ * @param next Output matrix of the vertex following u on a shortest path to v, or -1.
+ * @return False if the graph has a negative-weight cycle, true otherwise.
+ */
+bool FloydWarshall::AlgorithmCalculation(slistEl **adjList, int numVertices, int numThreads, DistanceMatrix &dist,
+                                         DistanceMatrix &next) {
+    const int block = DistanceMatrix::BLOCK;
+    int numBlocks = dist.NumBlocks();
+    dist.Fill(INF);
+    next.Fill(-1);
+    for (int u = 0; u < numVertices; u++) {
+        dist.Set(u, u, 0);
+        next.Set(u, u, u);
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            if (p->weight < dist.Get(u, p->v)) {
+                dist.Set(u, p->v, p->weight);
+                next.Set(u, p->v, p->v);
+            }
+        }
+    }
+
+    int threads = SSSPBatchRunner::ResolveThreads(numThreads);
+    int maxTiles = numBlocks * numBlocks;
+    if (threads > maxTiles) threads = maxTiles;
+    ThreadBarrier barrier(threads);
+    atomic<int> nextTile(0);
+
+    auto update = [&](int row, int col, int k) {
+        SimdKernels::MinPlusTile(dist.Tile(row, col), next.Tile(row, col), dist.Tile(row, k), next.Tile(row, k),
+                                 dist.Tile(k, col), block, INF);
+    };
+
+    auto worker = [&](int id) {
+        for (int k = 0; k < numBlocks; k++) {
+            // Phase 1: the diagonal tile depends only on itself
+            if (id == 0) {
+                update(k, k, k);
+                nextTile.store(0);
+            }
+            barrier.Wait();
+            // Phase 2: tiles of block row k and block column k
+            while (true) {
+                int t = nextTile.fetch_add(1);
+                if (t >= 2 * numBlocks) break;
+                int other = t % numBlocks;
+                if (other == k) continue;
+                if (t < numBlocks) {
+                    update(k, other, k);
+                } else {
+                    update(other, k, k);
+                }
+            }
+            barrier.Wait();
+            if (id == 0) {
+                nextTile.store(0);
+            }
+            barrier.Wait();
+            // Phase 3: every other tile depends only on its row and column tiles of phase 2
+            while (true) {
+                int t = nextTile.fetch_add(1);
+                if (t >= maxTiles) break;
+                int row = t / numBlocks;
+                int col = t % numBlocks;
+                if (row == k || col == k) continue;
+                update(row, col, k);
+            }
+            barrier.Wait();
+        }
+    };
+
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++) {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for (thread &t : pool) {
+        t.join();
+    }
+
+    bool negativeCycle = false;
+    for (int u = 0; u < numVertices; u++) {
+        if (dist.Get(u, u) < 0) negativeCycle = true;
+    }
+    int* row = new int[numVertices];
+    int* hops = new int[numVertices];
+    for (int u = 0; u < numVertices; u++) {
+        dist.GetRow(u, row);
+        next.GetRow(u, hops);
+        for (int v = 0; v < numVertices; v++) {
+            if (row[v] > INF / 2) {
+                row[v] = INT_MAX;
+                hops[v] = -1;
+            }
+        }
+        dist.SetRow(u, row);
+        next.SetRow(u, hops);
+    }
+    delete[] row;
+    delete[] hops;
+    return !negativeCycle;
+}
+
+/**
+ * @brief Reconstructs a shortest path from the next-hop matrix.
+ * @param next The next-hop matrix.
+ * @param u The first vertex.
+ * @param v The last vertex.
+ * @return The vertices of the path from u to v, or an empty vector if v is unreachable.
+ */
+vector<int> FloydWarshall::Path(const DistanceMatrix &next, int u, int v) {
+    vector<int> path;
+    if (next.Get(u, v) == -1) {
+        return path;
+    }
+    path.push_back(u);
+    while (u != v && (int) path.size() <= next.NumVertices()) {
+        u = next.Get(u, v);
+        path.push_back(u);
+    }
+    return path;
+}
+
+/**
+ * @brief Measures the algorithm, reports its throughput and compares it with one Dijkstra run per vertex.
+ *
+ * Throughput is counted as 2 V^3 operations (one add and one min per inner step) per second. The Dijkstra
+ * comparison only runs when no edge is negative.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+void FloydWarshall::TimeCounterList(slistEl **adjList, int numVertices) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Give number of threads (0 - all cores): ";
+    int numThreads;
+    cin >> numThreads;
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (iterations <= 0) iterations = 1;
+
+    DistanceMatrix dist(numVertices);
+    DistanceMatrix next(numVertices);
+    bool valid = true;
+    double wholeTime = 0;
+    for (int i = 0; i < iterations; i++) {
+        auto start = chrono::high_resolution_clock::now();
+        valid = AlgorithmCalculation(adjList, numVertices, numThreads, dist, next);
+        auto end = chrono::high_resolution_clock::now();
+        chrono::duration<double> elapsed = end - start;
+        cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
+        wholeTime += elapsed.count();
+    }
+    double avgTime = wholeTime / iterations;
+    double paddedVertices = (double) dist.NumBlocks() * DistanceMatrix::BLOCK;
+    cout << "Average time: " << avgTime * 1000 << " ms" << endl;
+    cout << "Kernel: " << SimdKernels::LevelName(SimdKernels::ActiveLevel()) << ", threads: "
+         << min(SSSPBatchRunner::ResolveThreads(numThreads), dist.NumBlocks() * dist.NumBlocks()) << endl;
+    cout << "Throughput: " << 2.0 * paddedVertices * paddedVertices * paddedVertices / avgTime / 1e9
+         << " Gop/s (add + min per inner step)" << endl;
+    if (!valid) {
+        cout << "Graph contains a negative-weight cycle" << endl;
+        return;
+    }
+
+    vector<int> path = FloydWarshall::Path(next, 0, numVertices - 1);
+    cout << "Shortest path from 0 to " << numVertices - 1 << ": ";
+    if (path.empty()) {
+        cout << "unreachable" << endl;
+    } else {
+        for (size_t i = 0; i < path.size(); i++) {
+            cout << path[i] << (i + 1 < path.size() ? " -> " : "");
+        }
+        cout << " (distance " << dist.Get(0, numVertices - 1) << ")" << endl;
+    }
+
+    bool negativeEdge = false;
+    for (int u = 0; u < numVertices && !negativeEdge; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            if (p->weight < 0) negativeEdge = true;
+        }
+    }
+    if (negativeEdge) {
+        return;
+    }
+    CsrGraph graph(adjList, numVertices);
+    int* row = new int[numVertices];
+    int mismatches = 0;
+    auto start = chrono::high_resolution_clock::now();
+    SSSPBatchRunner::Run(graph, nullptr, 0, numThreads, [&](int source, const int* d, const int*, int n, bool) {
+        dist.GetRow(source, row);
+        for (int v = 0; v < n; v++) {
+            if (row[v] != d[v]) mismatches++;
+        }
+    });
+    auto end = chrono::high_resolution_clock::now();
+    cout << "One Dijkstra per vertex: " << chrono::duration<double>(end - start).count() * 1000 << " ms";
+    cout << (mismatches > 0 ? ", distance mismatches: " + to_string(mismatches) : string(", same distances")) << endl;
+    delete[] row;
+}
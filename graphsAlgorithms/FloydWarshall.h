@@ -0,0 +1,56 @@
+/**
+ * @file FloydWarshall.h
+ * @brief This file contains the declaration of the FloydWarshall class.
+ */
+
+#ifndef FLOYDWARSHALL_H
+#define FLOYDWARSHALL_H
+
+#include <climits>
+#include <vector>
+#include "../GraphsGenerating.h"
+#include "DistanceMatrix.h"
+
+/**
+ * @class FloydWarshall
+ * @brief Class implementing a cache-blocked, multi-threaded Floyd-Warshall algorithm for dense graphs.
+ *
+ * The distance and next-hop matrices are stored as 64 x 64 tiles (16 KB each), so the three distance tiles and
+ * two next-hop tiles one update touches fit in L2 and the rows streamed by the inner loop stay in L1. For every
+ * block k the diagonal tile is updated first, then the tiles of block row and column k, then all remaining
+ * tiles; the tiles within the last two phases are independent and are shared out between threads.
+ */
+class FloydWarshall {
+public:
+    static const int INF = INT_MAX / 2; ///< Working value of a missing path; two of them add up without overflow
+
+    /**
+     * @brief Computes all shortest path distances and the next-hop matrix.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param numThreads The number of threads; 0 uses the hardware concurrency.
+     * @param dist Output matrix of distances (INT_MAX marks unreachable pairs); it must be kept in memory.
+     * @param next Output matrix of the vertex following u on a shortest path to v, or -1.
+     * @return False if the graph has a negative-weight cycle, true otherwise.
+     */
+    static bool AlgorithmCalculation(slistEl **adjList, int numVertices, int numThreads, DistanceMatrix &dist,
+                                     DistanceMatrix &next);
+
+    /**
+     * @brief Reconstructs a shortest path from the next-hop matrix.
+     * @param next The next-hop matrix.
+     * @param u The first vertex.
+     * @param v The last vertex.
+     * @return The vertices of the path from u to v, or an empty vector if v is unreachable.
+     */
+    static std::vector<int> Path(const DistanceMatrix &next, int u, int v);
+
+    /**
+     * @brief Measures the algorithm, reports its throughput and compares it with one Dijkstra run per vertex.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices);
+};
+
+#endif // FLOYDWARSHALL_H
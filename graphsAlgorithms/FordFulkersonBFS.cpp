@@ -1,8 +1,11 @@
 #include "FordFulkersonBFS.h"
+#include "../ResultCache.h"
+#include "SimdKernels.h"
 #include "../GraphsGenerating.h"
 #include <iostream>
 #include <climits>
 #include <chrono>
+#include <vector>
 
 using namespace std;
 
@@ -16,6 +19,7 @@ using namespace std;
 bool FordFulkersonBFS::bfsIncMatrix(int **incMatrix, int source, int sink, int parent[], int numVertices, int numEdges) {
     bool *visited = new bool[numVertices]();
     int *queue = new int[numVertices];
+    int *outgoing = new int[numEdges]; // Edges with remaining capacity out of the current vertex
     int front = 0, back = 0;
     queue[back++] = source;
     visited[source] = true;
@@ -23,32 +27,34 @@ bool FordFulkersonBFS::bfsIncMatrix(int **incMatrix, int source, int sink, int p
 
     while (front != back) {
         int u = queue[front++];
-        for (int e = 0; e < numEdges; e++) {
-            if (incMatrix[u][e] > 0) {
-                int v = -1;
-                for (int i = 0; i < numVertices; i++) {
-                    if (i != u && incMatrix[i][e] < 0) {
-                        v = i;
-                        break;
-                    }
+        int numOutgoing = SimdKernels::PositivePositions(incMatrix[u], numEdges, outgoing);
+        for (int k = 0; k < numOutgoing; k++) {
+            int e = outgoing[k];
+            int v = -1;
+            for (int i = 0; i < numVertices; i++) {
+                if (i != u && incMatrix[i][e] < 0) {
+                    v = i;
+                    break;
                 }
-                if (v != -1 && !visited[v]) {
-                    if (v == sink) {
-                        parent[v] = u;
-                        delete[] visited;
-                        delete[] queue;
-                        return true;
-                    }
-                    queue[back++] = v;
-                    visited[v] = true;
+            }
+            if (v != -1 && !visited[v]) {
+                if (v == sink) {
                     parent[v] = u;
+                    delete[] visited;
+                    delete[] queue;
+                    delete[] outgoing;
+                    return true;
                 }
+                queue[back++] = v;
+                visited[v] = true;
+                parent[v] = u;
             }
         }
     }
 
     delete[] visited;
     delete[] queue;
+    delete[] outgoing;
     return false;
 }
 
@@ -58,8 +64,10 @@ bool FordFulkersonBFS::bfsIncMatrix(int **incMatrix, int source, int sink, int p
  * @param source The source vertex.
  * @param sink The sink vertex.
  * @param numVertices The number of vertices in the graph.
+ * @param sourceSide Optional output of the source side of the minimum cut.
  */
-int FordFulkersonBFS::AlgorithmCalculationFromIncMatrix(int **incMatrix, int source, int sink, int numVertices, int numEdges) {
+int FordFulkersonBFS::AlgorithmCalculationFromIncMatrix(int **incMatrix, int source, int sink, int numVertices, int numEdges,
+                                                        bool *sourceSide) {
     int **residualGraph = new int *[numVertices];
     for (int i = 0; i < numVertices; ++i) {
         residualGraph[i] = new int[numEdges];
@@ -97,6 +105,9 @@ int FordFulkersonBFS::AlgorithmCalculationFromIncMatrix(int **incMatrix, int sou
         maxFlow += pathFlow;
     }
 
+    if (sourceSide != nullptr) {
+        FordFulkersonBFS::SourceSideIncMatrix(incMatrix, residualGraph, source, numVertices, numEdges, sourceSide);
+    }
     for (int i = 0; i < numVertices; ++i) {
         delete[] residualGraph[i];
     }
@@ -135,6 +146,13 @@ void FordFulkersonBFS::PrintResults(int maxFlow, double elapsed, int **residualG
  * @param numEdges The number of edges in the graph.
  */
 void FordFulkersonBFS::TimeCounterIncMatrix(int **incMatrix, int source, int sink, int numVertices, int numEdges) {
+    int cachedFlow;
+    const bool* cachedCut;
+    if (ResultCache::LookupMaxFlow(ResultCache::FORD_FULKERSON_BFS, ResultCache::MATRIX, source, sink, &cachedFlow, &cachedCut)) {
+        cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+        printf("Max Flow: %d\n", cachedFlow);
+        return;
+    }
     cout << "Give number of iterations: ";
     int iterations;
     float wholeTime = 0;
@@ -142,9 +160,11 @@ void FordFulkersonBFS::TimeCounterIncMatrix(int **incMatrix, int source, int sin
     cin >> iterations;
     cout << endl;
 
+    bool* sourceSide = new bool[numVertices];
     for (int i = 0; i < iterations; i++) {
         auto start = chrono::high_resolution_clock::now();
-        int maxFlow = AlgorithmCalculationFromIncMatrix(incMatrix, source, sink, numVertices, numEdges);
+        int maxFlow = AlgorithmCalculationFromIncMatrix(incMatrix, source, sink, numVertices, numEdges,
+                                                        i == iterations - 1 ? sourceSide : nullptr);
         auto end = chrono::high_resolution_clock::now();
         chrono::duration<double> elapsed = end - start;
         if (iterations == 1) {
@@ -152,7 +172,14 @@ void FordFulkersonBFS::TimeCounterIncMatrix(int **incMatrix, int source, int sin
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            // Without reverse arcs the search can stop short of a maximum flow; the residual graph then still
+            // reaches the sink and there is no cut to store
+            const bool* cut = sourceSide[sink] ? nullptr : sourceSide;
+            ResultCache::StoreMaxFlow(ResultCache::FORD_FULKERSON_BFS, ResultCache::MATRIX, source, sink, maxFlow, cut, numVertices);
+        }
     }
+    delete[] sourceSide;
 
     avgTime = wholeTime / iterations * 1000;
     cout << "Average time: " << avgTime << " ms" << endl;
@@ -204,9 +231,10 @@ bool FordFulkersonBFS::bfsList(slistEl **residualGraph, int source, int sink, in
  * @param source The source vertex.
  * @param sink The sink vertex.
  * @param numVertices The number of vertices in the graph.
+ * @param sourceSide Optional output of the source side of the minimum cut.
  * @return The maximum flow from source to sink.
  */
-int FordFulkersonBFS::AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices) {
+int FordFulkersonBFS::AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices, bool *sourceSide) {
     slistEl **residualGraph = new slistEl *[numVertices];
     for (int u = 0; u < numVertices; u++) {
         residualGraph[u] = nullptr;
@@ -250,6 +278,9 @@ int FordFulkersonBFS::AlgorithmCalculationFromList(slistEl **graph, int source,
         maxFlow += pathFlow;
     }
 
+    if (sourceSide != nullptr) {
+        FordFulkersonBFS::SourceSideList(graph, residualGraph, source, numVertices, sourceSide);
+    }
     for (int i = 0; i < numVertices; i++) {
         slistEl* p = residualGraph[i];
         while (p != nullptr) {
@@ -293,6 +324,13 @@ void FordFulkersonBFS::PrintResultsList(int maxFlow, slistEl **residualGraph, in
  * @param numVertices The number of vertices in the graph.
  */
 void FordFulkersonBFS::TimeCounterList(slistEl **graph, int source, int sink, int numVertices) {
+    int cachedFlow;
+    const bool* cachedCut;
+    if (ResultCache::LookupMaxFlow(ResultCache::FORD_FULKERSON_BFS, ResultCache::LIST, source, sink, &cachedFlow, &cachedCut)) {
+        cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+        printf("Max Flow: %d\n", cachedFlow);
+        return;
+    }
     cout << "Give number of iterations: ";
     int iterations;
     float wholeTime = 0;
@@ -300,9 +338,11 @@ void FordFulkersonBFS::TimeCounterList(slistEl **graph, int source, int sink, in
     cin >> iterations;
     cout << endl;
 
+    bool* sourceSide = new bool[numVertices];
     for (int i = 0; i < iterations; i++) {
         auto start = chrono::high_resolution_clock::now();
-        int maxFlow = AlgorithmCalculationFromList(graph, source, sink, numVertices);
+        int maxFlow = AlgorithmCalculationFromList(graph, source, sink, numVertices,
+                                                   i == iterations - 1 ? sourceSide : nullptr);
         auto end = chrono::high_resolution_clock::now();
         chrono::duration<double> elapsed = end - start;
         if (iterations == 1) {
@@ -310,8 +350,131 @@ void FordFulkersonBFS::TimeCounterList(slistEl **graph, int source, int sink, in
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            // Without reverse arcs the search can stop short of a maximum flow; the residual graph then still
+            // reaches the sink and there is no cut to store
+            const bool* cut = sourceSide[sink] ? nullptr : sourceSide;
+            ResultCache::StoreMaxFlow(ResultCache::FORD_FULKERSON_BFS, ResultCache::LIST, source, sink, maxFlow, cut, numVertices);
+        }
     }
+    delete[] sourceSide;
 
     avgTime = wholeTime / iterations * 1000;
     cout << "Average time: " << avgTime << " ms" << endl;
-}
\ No newline at end of file
+}
+/**
+ * @brief Marks the source side of the minimum cut left by a finished run on an incidence matrix.
+ *
+ * The residual graph holds the remaining capacity of every edge and, implicitly, a reverse arc for every edge
+ * that carries flow. Both are followed from the source, so the cut is a minimum one even though the search of
+ * the algorithm itself only uses the remaining capacities.
+ *
+ * @param incMatrix The incidence matrix representing the graph.
+ * @param residualGraph The residual capacities the run ended with.
+ * @param source The source vertex.
+ * @param numVertices The number of vertices in the graph.
+ * @param numEdges The number of edges in the graph.
+ * @param sourceSide Output array, true for the vertices reachable from the source in the residual graph.
+ * @return The number of vertices on the source side.
+ */
+int FordFulkersonBFS::SourceSideIncMatrix(int **incMatrix, int **residualGraph, int source, int numVertices, int numEdges,
+                                          bool *sourceSide) {
+    int *tail = new int[numEdges];
+    int *head = new int[numEdges];
+    for (int e = 0; e < numEdges; e++) {
+        tail[e] = head[e] = -1;
+        for (int i = 0; i < numVertices; i++) {
+            if (incMatrix[i][e] > 0) {
+                tail[e] = i;
+            } else if (incMatrix[i][e] < 0) {
+                head[e] = i;
+            }
+        }
+    }
+
+    for (int v = 0; v < numVertices; v++) {
+        sourceSide[v] = false;
+    }
+    int *queue = new int[numVertices];
+    int front = 0, back = 0;
+    queue[back++] = source;
+    sourceSide[source] = true;
+    while (front != back) {
+        int u = queue[front++];
+        for (int e = 0; e < numEdges; e++) {
+            if (tail[e] == -1 || head[e] == -1) continue;
+            int v = -1;
+            if (tail[e] == u && residualGraph[u][e] > 0) {
+                v = head[e];
+            } else if (head[e] == u && residualGraph[tail[e]][e] < incMatrix[tail[e]][e]) {
+                v = tail[e];
+            }
+            if (v != -1 && !sourceSide[v]) {
+                sourceSide[v] = true;
+                queue[back++] = v;
+            }
+        }
+    }
+
+    delete[] tail;
+    delete[] head;
+    delete[] queue;
+    return back;
+}
+
+/**
+ * @brief Marks the source side of the minimum cut left by a finished run on an adjacency list.
+ *
+ * Arcs with remaining capacity are followed forwards and arcs that carry flow backwards. The flow of an arc is
+ * its capacity in graph minus its residual capacity; the residual lists are built by prepending, so they hold
+ * the arcs of every vertex in reverse order.
+ *
+ * @param graph The adjacency list representing the graph.
+ * @param residualGraph The residual lists the run ended with.
+ * @param source The source vertex.
+ * @param numVertices The number of vertices in the graph.
+ * @param sourceSide Output array, true for the vertices reachable from the source in the residual graph.
+ * @return The number of vertices on the source side.
+ */
+int FordFulkersonBFS::SourceSideList(slistEl **graph, slistEl **residualGraph, int source, int numVertices, bool *sourceSide) {
+    vector<vector<int>> flowTails(numVertices); // Tails of the arcs carrying flow into every vertex
+    vector<int> capacities;
+    for (int u = 0; u < numVertices; u++) {
+        capacities.clear();
+        for (slistEl* p = graph[u]; p != nullptr; p = p->next) {
+            capacities.push_back(p->weight);
+        }
+        int k = (int) capacities.size();
+        for (slistEl* p = residualGraph[u]; p != nullptr; p = p->next) {
+            if (p->weight < capacities[--k]) {
+                flowTails[p->v].push_back(u);
+            }
+        }
+    }
+
+    for (int v = 0; v < numVertices; v++) {
+        sourceSide[v] = false;
+    }
+    int *queue = new int[numVertices];
+    int front = 0, back = 0;
+    queue[back++] = source;
+    sourceSide[source] = true;
+    while (front != back) {
+        int u = queue[front++];
+        for (slistEl* p = residualGraph[u]; p != nullptr; p = p->next) {
+            if (p->weight > 0 && !sourceSide[p->v]) {
+                sourceSide[p->v] = true;
+                queue[back++] = p->v;
+            }
+        }
+        for (int v : flowTails[u]) {
+            if (!sourceSide[v]) {
+                sourceSide[v] = true;
+                queue[back++] = v;
+            }
+        }
+    }
+
+    delete[] queue;
+    return back;
+}
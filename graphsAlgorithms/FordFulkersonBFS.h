@@ -32,9 +32,11 @@ public:
      * @param sink The sink vertex.
      * @param numVertices The number of vertices in the graph.
      * @param numEdges The number of edges in the graph.
+     * @param sourceSide Optional output of the source side of the minimum cut.
      * @return The maximum flow from source to sink.
      */
-    static int AlgorithmCalculationFromIncMatrix(int **incMatrix, int source, int sink, int numVertices, int numEdges);
+    static int AlgorithmCalculationFromIncMatrix(int **incMatrix, int source, int sink, int numVertices, int numEdges,
+                                                 bool *sourceSide = nullptr);
 
     /**
      * @brief Prints the results of the Ford-Fulkerson algorithm with BFS.
@@ -72,9 +74,11 @@ public:
      * @param source The source vertex.
      * @param sink The sink vertex.
      * @param numVertices The number of vertices in the graph.
+     * @param sourceSide Optional output of the source side of the minimum cut.
      * @return The maximum flow from source to sink.
      */
-    static int AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices);
+    static int AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices,
+                                            bool *sourceSide = nullptr);
 
     /**
      * @brief Prints the results of the Ford-Fulkerson algorithm with BFS on a graph represented as an adjacency list.
@@ -92,6 +96,30 @@ public:
      * @param numVertices The number of vertices in the graph.
      */
     static void TimeCounterList(slistEl **graph, int source, int sink, int numVertices);
+
+    /**
+     * @brief Marks the source side of the minimum cut left by a finished run on an incidence matrix.
+     * @param incMatrix The incidence matrix representing the graph.
+     * @param residualGraph The residual capacities the run ended with.
+     * @param source The source vertex.
+     * @param numVertices The number of vertices in the graph.
+     * @param numEdges The number of edges in the graph.
+     * @param sourceSide Output array, true for the vertices reachable from the source in the residual graph.
+     * @return The number of vertices on the source side.
+     */
+    static int SourceSideIncMatrix(int **incMatrix, int **residualGraph, int source, int numVertices, int numEdges,
+                                   bool *sourceSide);
+
+    /**
+     * @brief Marks the source side of the minimum cut left by a finished run on an adjacency list.
+     * @param graph The adjacency list representing the graph.
+     * @param residualGraph The residual lists the run ended with; every list holds the arcs of graph in reverse order.
+     * @param source The source vertex.
+     * @param numVertices The number of vertices in the graph.
+     * @param sourceSide Output array, true for the vertices reachable from the source in the residual graph.
+     * @return The number of vertices on the source side.
+     */
+    static int SourceSideList(slistEl **graph, slistEl **residualGraph, int source, int numVertices, bool *sourceSide);
 };
 
 #endif
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "FordFulkersonDFS.h"
+#include "FordFulkersonBFS.h"
+#include "../ResultCache.h"
 #include <iostream>
 #include <climits>
 #include <chrono>
@@ -61,9 +63,11 @@ bool FordFulkersonDFS::dfsIncMatrix(int **residualGraph, int source, int sink, i
  * @param sink The sink vertex.
  * @param numVertices The number of vertices in the graph.
  * @param numEdges The number of edges in the graph.
+ * @param sourceSide Optional output of the source side of the minimum cut.
  * @return The maximum flow from source to sink.
  */
-int FordFulkersonDFS::AlgorithmCalculationFromIncMatrix(int **incMatrix, int source, int sink, int numVertices, int numEdges) {
+int FordFulkersonDFS::AlgorithmCalculationFromIncMatrix(int **incMatrix, int source, int sink, int numVertices, int numEdges,
+                                                        bool *sourceSide) {
     int **residualGraph = new int *[numVertices];
     for (int i = 0; i < numVertices; ++i) {
         residualGraph[i] = new int[numEdges];
@@ -101,6 +105,9 @@ int FordFulkersonDFS::AlgorithmCalculationFromIncMatrix(int **incMatrix, int sou
         maxFlow += pathFlow;
     }
 
+    if (sourceSide != nullptr) {
+        FordFulkersonBFS::SourceSideIncMatrix(incMatrix, residualGraph, source, numVertices, numEdges, sourceSide);
+    }
     for (int i = 0; i < numVertices; ++i) {
         delete[] residualGraph[i];
     }
@@ -182,9 +189,10 @@ bool FordFulkersonDFS::dfsList(slistEl **residualGraph, int source, int sink, in
  * @param source The source vertex.
  * @param sink The sink vertex.
  * @param numVertices The number of vertices in the graph.
+ * @param sourceSide Optional output of the source side of the minimum cut.
  * @return The maximum flow from source to sink.
  */
-int FordFulkersonDFS::AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices) {
+int FordFulkersonDFS::AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices, bool *sourceSide) {
     slistEl **residualGraph = new slistEl *[numVertices];
     for (int u = 0; u < numVertices; u++) {
         residualGraph[u] = nullptr;
@@ -228,6 +236,9 @@ int FordFulkersonDFS::AlgorithmCalculationFromList(slistEl **graph, int source,
         maxFlow += pathFlow;
     }
 
+    if (sourceSide != nullptr) {
+        FordFulkersonBFS::SourceSideList(graph, residualGraph, source, numVertices, sourceSide);
+    }
     for (int i = 0; i < numVertices; i++) {
         slistEl* p = residualGraph[i];
         while (p != nullptr) {
@@ -271,6 +282,13 @@ void FordFulkersonDFS::PrintResultsList(int maxFlow, double elapsed, slistEl **r
  * @param numEdges The number of edges in the graph.
  */
 void FordFulkersonDFS::TimeCounterIncMatrix(int **incMatrix, int source, int sink, int numVertices, int numEdges) {
+    int cachedFlow;
+    const bool* cachedCut;
+    if (ResultCache::LookupMaxFlow(ResultCache::FORD_FULKERSON_DFS, ResultCache::MATRIX, source, sink, &cachedFlow, &cachedCut)) {
+        cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+        printf("Max Flow: %d\n", cachedFlow);
+        return;
+    }
     cout << "Give number of iterations: ";
     int iterations;
     float wholeTime = 0;
@@ -278,9 +296,11 @@ void FordFulkersonDFS::TimeCounterIncMatrix(int **incMatrix, int source, int sin
     cin >> iterations;
     cout << endl;
 
+    bool* sourceSide = new bool[numVertices];
     for (int i = 0; i < iterations; i++) {
         auto start = chrono::high_resolution_clock::now();
-        int maxFlow = AlgorithmCalculationFromIncMatrix(incMatrix, source, sink, numVertices, numEdges);
+        int maxFlow = AlgorithmCalculationFromIncMatrix(incMatrix, source, sink, numVertices, numEdges,
+                                                        i == iterations - 1 ? sourceSide : nullptr);
         auto end = chrono::high_resolution_clock::now();
         chrono::duration<double> elapsed = end - start;
         if (iterations == 1) {
@@ -288,7 +308,14 @@ void FordFulkersonDFS::TimeCounterIncMatrix(int **incMatrix, int source, int sin
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            // Without reverse arcs the search can stop short of a maximum flow; the residual graph then still
+            // reaches the sink and there is no cut to store
+            const bool* cut = sourceSide[sink] ? nullptr : sourceSide;
+            ResultCache::StoreMaxFlow(ResultCache::FORD_FULKERSON_DFS, ResultCache::MATRIX, source, sink, maxFlow, cut, numVertices);
+        }
     }
+    delete[] sourceSide;
 
     avgTime = wholeTime / iterations * 1000;
     cout << "Average time: " << avgTime << " ms" << endl;
@@ -301,6 +328,13 @@ void FordFulkersonDFS::TimeCounterIncMatrix(int **incMatrix, int source, int sin
  * @param numVertices The number of vertices in the graph.
  */
 }void FordFulkersonDFS::TimeCounterList(slistEl **graph, int source, int sink, int numVertices) {
+    int cachedFlow;
+    const bool* cachedCut;
+    if (ResultCache::LookupMaxFlow(ResultCache::FORD_FULKERSON_DFS, ResultCache::LIST, source, sink, &cachedFlow, &cachedCut)) {
+        cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+        printf("Max Flow: %d\n", cachedFlow);
+        return;
+    }
     cout << "Give number of iterations: ";
     int iterations;
     float wholeTime = 0;
@@ -308,9 +342,11 @@ void FordFulkersonDFS::TimeCounterIncMatrix(int **incMatrix, int source, int sin
     cin >> iterations;
     cout << endl;
 
+    bool* sourceSide = new bool[numVertices];
     for (int i = 0; i < iterations; i++) {
         auto start = chrono::high_resolution_clock::now();
-        int maxFlow = AlgorithmCalculationFromList(graph, source, sink, numVertices);
+        int maxFlow = AlgorithmCalculationFromList(graph, source, sink, numVertices,
+                                                   i == iterations - 1 ? sourceSide : nullptr);
         auto end = chrono::high_resolution_clock::now();
         chrono::duration<double> elapsed = end - start;
         if (iterations == 1) {
@@ -318,7 +354,14 @@ void FordFulkersonDFS::TimeCounterIncMatrix(int **incMatrix, int source, int sin
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            // Without reverse arcs the search can stop short of a maximum flow; the residual graph then still
+            // reaches the sink and there is no cut to store
+            const bool* cut = sourceSide[sink] ? nullptr : sourceSide;
+            ResultCache::StoreMaxFlow(ResultCache::FORD_FULKERSON_DFS, ResultCache::LIST, source, sink, maxFlow, cut, numVertices);
+        }
     }
+    delete[] sourceSide;
 
     avgTime = wholeTime / iterations * 1000;
     cout << "Average time: " << avgTime << " ms" << endl;
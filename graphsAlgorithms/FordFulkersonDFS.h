@@ -61,9 +61,11 @@ public:
      * @param sink The sink vertex.
      * @param numVertices The number of vertices in the graph.
      * @param numEdges The number of edges in the graph.
+     * @param sourceSide Optional output of the source side of the minimum cut.
      * @return The maximum flow.
      */
-    static int AlgorithmCalculationFromIncMatrix(int **incMatrix, int source, int sink, int numVertices, int numEdges);
+    static int AlgorithmCalculationFromIncMatrix(int **incMatrix, int source, int sink, int numVertices, int numEdges,
+                                                 bool *sourceSide = nullptr);
 
     /**
      * @brief Runs the Ford-Fulkerson algorithm on a graph represented as an adjacency list.
@@ -72,9 +74,11 @@ public:
      * @param source The source vertex.
      * @param sink The sink vertex.
      * @param numVertices The number of vertices in the graph.
+     * @param sourceSide Optional output of the source side of the minimum cut.
      * @return The maximum flow.
      */
-    static int AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices);
+    static int AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices,
+                                            bool *sourceSide = nullptr);
 
     /**
      * @brief Prints the results of the Ford-Fulkerson algorithm.
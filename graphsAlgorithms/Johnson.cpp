@@ -0,0 +1,165 @@
+/**
+ * @file Johnson.cpp
+ * @brief This file contains the implementation of the Johnson class.
+ */
+
+#include "Johnson.h"
+#include "BellmanFord.h"
+#include "CsrGraph.h"
+#include "NegativeCycleDetector.h"
+#include "SSSPBatchRunner.h"
+#include <iostream>
+#include <climits>
+#include <cstdlib>
+#include <chrono>
+#include <filesystem>
+
+using namespace std;
+
+double Johnson::lastPotentialTime = 0;
+double Johnson::lastReweightTime = 0;
+double Johnson::lastDijkstraTime = 0;
+
+/**
+ * @brief Computes all shortest path distances.
+ *
+ * The virtual source is appended as vertex numVertices; its list holds a zero-weight edge to every vertex and the
+ * other lists are shared with the input, so nothing is copied. The queue-based Bellman-Ford gives the potentials.
+ * Each Dijkstra row is converted back with d(u, v) = d'(u, v) - h(u) + h(v) before it is stored.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param numThreads The number of threads of the Dijkstra phase; 0 uses the hardware concurrency.
+ * @param spillPath Path of a file to spill the distance matrix to, or nullptr to keep it in memory.
+ * @param cycle Optional output: a negative cycle, if the graph has one.
+ * @return The distance matrix (INT_MAX marks unreachable pairs), or nullptr if the graph has a negative cycle.
+ */
+DistanceMatrix* Johnson::AlgorithmCalculation(slistEl **adjList, int numVertices, int numThreads, const char *spillPath,
+                                              vector<int> *cycle) {
+    auto start = chrono::high_resolution_clock::now();
+    slistEl** augmented = new slistEl*[numVertices + 1];
+    augmented[numVertices] = nullptr;
+    for (int v = 0; v < numVertices; v++) {
+        augmented[v] = adjList[v];
+        augmented[numVertices] = new slistEl{v, 0, augmented[numVertices]};
+    }
+    int* potential = new int[numVertices + 1];
+    int* prev = new int[numVertices + 1];
+    bool valid = BellmanFord::AlgorithmCalculationFromListQueue(augmented, numVertices + 1, numVertices, potential, prev);
+    for (slistEl* p = augmented[numVertices]; p != nullptr;) {
+        slistEl* r = p;
+        p = p->next;
+        delete r;
+    }
+    delete[] augmented;
+    delete[] prev;
+    auto end = chrono::high_resolution_clock::now();
+    lastPotentialTime = chrono::duration<double>(end - start).count();
+    if (!valid) {
+        if (cycle != nullptr) {
+            *cycle = NegativeCycleDetector::FindAnyCycle(adjList, numVertices);
+        }
+        delete[] potential;
+        return nullptr;
+    }
+
+    start = chrono::high_resolution_clock::now();
+    CsrGraph reweighted(adjList, numVertices);
+    for (int u = 0; u < numVertices; u++) {
+        for (int e = reweighted.offsets[u]; e < reweighted.offsets[u + 1]; e++) {
+            reweighted.weights[e] += potential[u] - potential[reweighted.targets[e]];
+        }
+    }
+    end = chrono::high_resolution_clock::now();
+    lastReweightTime = chrono::duration<double>(end - start).count();
+
+    start = chrono::high_resolution_clock::now();
+    DistanceMatrix* distances = new DistanceMatrix(numVertices, spillPath);
+    int* row = new int[numVertices];
+    SSSPBatchRunner::Run(reweighted, nullptr, 0, numThreads,
+                         [&](int source, const int* dist, const int*, int n, bool) {
+                             for (int v = 0; v < n; v++) {
+                                 row[v] = dist[v] == INT_MAX ? INT_MAX
+                                                             : (int) ((long long) dist[v] - potential[source] + potential[v]);
+                             }
+                             distances->SetRow(source, row);
+                         });
+    end = chrono::high_resolution_clock::now();
+    lastDijkstraTime = chrono::duration<double>(end - start).count();
+
+    delete[] row;
+    delete[] potential;
+    return distances;
+}
+
+/**
+ * @brief Measures the phases of the algorithm and checks a few rows against Bellman-Ford.
+ *
+ * The matrix can be kept in memory or spilled to a file in the system temporary directory.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+void Johnson::TimeCounterList(slistEl **adjList, int numVertices) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Give number of threads (0 - all cores): ";
+    int numThreads;
+    cin >> numThreads;
+    cout << "Store the distance matrix (0 - in memory, 1 - spilled to a temporary file): ";
+    int spill;
+    cin >> spill;
+    cout << endl;
+
+    string spillPath;
+    if (spill == 1) {
+        spillPath = (filesystem::temp_directory_path() / "graph_efficiency_distances.bin").string();
+    }
+
+    vector<int> cycle;
+    auto start = chrono::high_resolution_clock::now();
+    DistanceMatrix* distances = AlgorithmCalculation(adjList, numVertices, numThreads,
+                                                     spillPath.empty() ? nullptr : spillPath.c_str(), &cycle);
+    auto end = chrono::high_resolution_clock::now();
+    cout << "Bellman-Ford potentials: " << lastPotentialTime * 1000 << " ms" << endl;
+    if (distances == nullptr) {
+        cout << "Graph contains a negative-weight cycle: ";
+        NegativeCycleDetector::PrintCycle(adjList, cycle);
+        return;
+    }
+    cout << "Reweighting into CSR: " << lastReweightTime * 1000 << " ms" << endl;
+    cout << "Dijkstra phase (" << min(SSSPBatchRunner::ResolveThreads(numThreads), numVertices) << " threads): "
+         << lastDijkstraTime * 1000 << " ms" << endl;
+    cout << "Elapsed time: " << chrono::duration<double>(end - start).count() * 1000 << " ms" << endl;
+    cout << "Distance matrix: " << distances->Bytes() / (1024.0 * 1024.0) << " MB"
+         << (distances->IsSpilled() ? " (spilled to " + spillPath + ")" : string(" (in memory)")) << endl;
+
+    // Verify a few rows against Bellman-Ford, which handles negative edges directly
+    int* dist = new int[numVertices];
+    int* prev = new int[numVertices];
+    int* row = new int[numVertices];
+    int mismatches = 0;
+    int checks = min(3, numVertices);
+    for (int i = 0; i < checks; i++) {
+        int source = rand() % numVertices;
+        BellmanFord::AlgorithmCalculationFromListQueue(adjList, numVertices, source, dist, prev);
+        distances->GetRow(source, row);
+        for (int v = 0; v < numVertices; v++) {
+            if (row[v] != dist[v]) mismatches++;
+        }
+    }
+    cout << "Rows checked against Bellman-Ford: " << checks << ", mismatches: " << mismatches << endl;
+    cout << "Distance from 0 to " << numVertices - 1 << ": ";
+    if (distances->Get(0, numVertices - 1) == INT_MAX) {
+        cout << "unreachable" << endl;
+    } else {
+        cout << distances->Get(0, numVertices - 1) << endl;
+    }
+
+    delete[] dist;
+    delete[] prev;
+    delete[] row;
+    delete distances;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file Johnson.h
+ * @brief This file contains the declaration of the Johnson class.
+ */
+
+#ifndef JOHNSON_H
+#define JOHNSON_H
+
+#include <vector>
+#include "../GraphsGenerating.h"
+#include "DistanceMatrix.h"
+
+/**
+ * @class Johnson
+ * @brief Class implementing Johnson's all-pairs shortest paths algorithm for sparse graphs with negative edges.
+ *
+ * Bellman-Ford from a virtual source gives every vertex a potential h. Reweighting each edge to
+ * w + h(u) - h(v) makes all weights non-negative without changing which paths are shortest, so V independent
+ * Dijkstra runs on the reweighted CSR graph, spread over a thread pool, give all distances.
+ */
+class Johnson {
+public:
+    /**
+     * @brief Computes all shortest path distances.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param numThreads The number of threads of the Dijkstra phase; 0 uses the hardware concurrency.
+     * @param spillPath Path of a file to spill the distance matrix to, or nullptr to keep it in memory.
+     * @param cycle Optional output: a negative cycle, if the graph has one.
+     * @return The distance matrix (INT_MAX marks unreachable pairs), or nullptr if the graph has a negative cycle.
+     */
+    static DistanceMatrix* AlgorithmCalculation(slistEl **adjList, int numVertices, int numThreads, const char *spillPath,
+                                                std::vector<int> *cycle = nullptr);
+
+    /**
+     * @brief Measures the phases of the algorithm and checks a few rows against Bellman-Ford.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices);
+
+    static double lastPotentialTime; ///< Seconds spent on Bellman-Ford in the last run
+    static double lastReweightTime; ///< Seconds spent on building the reweighted CSR graph in the last run
+    static double lastDijkstraTime; ///< Seconds spent on the Dijkstra phase in the last run
+};
+
+#endif // JOHNSON_H
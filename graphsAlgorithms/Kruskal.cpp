@@ -4,16 +4,24 @@
  */
 
 #include "Kruskal.h"
+#include "EdgeSort.h"
+#include "EdgeListBuilder.h"
 #include <iostream>
 #include <cstdio>
 #include <cstdlib>
 #include <chrono>
+#include <algorithm>
 
 using namespace std;
 
 // The resulting MST, stored as an array of edges
 Kruskal::Edge* Kruskal::mst = nullptr;
 int Kruskal::mstSize = 0;
+Kruskal::SortStrategy Kruskal::sortStrategy = Kruskal::AUTO_SORT;
+Kruskal::SortStrategy Kruskal::lastSortStrategy = Kruskal::AUTO_SORT;
+double Kruskal::lastSortTime = 0;
+long long Kruskal::lastSortedEdges = 0;
+long long Kruskal::lastFilteredEdges = 0;
 
 /**
  * @brief Finds the set of an element i (uses path compression technique).
@@ -52,73 +60,6 @@ void Kruskal::Union(int parent[], int rank[], int x, int y) {
     }
 }
 
-/**
- * @brief Merges two subarrays of edges.
- *
- * @param edges The array of edges.
- * @param left The left index.
- * @param mid The middle index.
- * @param right The right index.
- */
-void merge(Kruskal::Edge edges[], int left, int mid, int right) {
-    int n1 = mid - left + 1;
-    int n2 = right - mid;
-
-    Kruskal::Edge* L = new Kruskal::Edge[n1];
-    Kruskal::Edge* R = new Kruskal::Edge[n2];
-
-    for (int i = 0; i < n1; i++) {
-        L[i] = edges[left + i];
-    }
-    for (int j = 0; j < n2; j++) {
-        R[j] = edges[mid + 1 + j];
-    }
-
-    int i = 0, j = 0, k = left;
-    while (i < n1 && j < n2) {
-        if (L[i].weight <= R[j].weight) {
-            edges[k] = L[i];
-            i++;
-        } else {
-            edges[k] = R[j];
-            j++;
-        }
-        k++;
-    }
-
-    while (i < n1) {
-        edges[k] = L[i];
-        i++;
-        k++;
-    }
-
-    while (j < n2) {
-        edges[k] = R[j];
-        j++;
-        k++;
-    }
-
-    delete[] L;
-    delete[] R;
-}
-
-/**
- * @brief Sorts edges using merge sort.
- *
- * @param edges The array of edges.
- * @param left The left index.
- * @param right The right index.
- */
-void mergeSort(Kruskal::Edge edges[], int left, int right) {
-    if (left >= right) {
-        return;
-    }
-    int mid = left + (right - left) / 2;
-    mergeSort(edges, left, mid);
-    mergeSort(edges, mid + 1, right);
-    merge(edges, left, mid, right);
-}
-
 /**
  * @brief Runs Kruskal's algorithm on a graph represented as an incidence matrix.
  *
@@ -128,28 +69,12 @@ void mergeSort(Kruskal::Edge edges[], int left, int right) {
  * @return The total weight of the MST.
  */
 int Kruskal::AlgorithmCalculationFromMatrix(int **incMatrix, int numVertices, int numEdges) {
-    Edge* edges = new Edge[numEdges];
-    int edgeCount = 0;
-
-    for (int e = 0; e < numEdges; ++e) {
-        int u = -1, v = -1, weight = 0;
-        for (int i = 0; i < numVertices; ++i) {
-            if (incMatrix[i][e] != 0) {
-                if (u == -1) {
-                    u = i;
-                    weight = abs(incMatrix[i][e]);
-                } else {
-                    v = i;
-                    break;
-                }
-            }
-        }
-        if (u != -1 && v != -1) {
-            edges[edgeCount++] = {u, v, weight};
-        }
-    }
+    int edgeCount;
+    Edge* edges = EdgeListBuilder::FromMatrix(incMatrix, numVertices, numEdges, 0, &edgeCount);
 
-    mergeSort(edges, 0, edgeCount - 1);
+    auto sortStart = chrono::high_resolution_clock::now();
+    lastSortStrategy = EdgeSort::Sort(edges, edgeCount, sortStrategy);
+    lastSortTime = chrono::duration<double>(chrono::high_resolution_clock::now() - sortStart).count();
 
     int *parent = new int[numVertices];
     int *rank = new int[numVertices];
@@ -192,26 +117,12 @@ int Kruskal::AlgorithmCalculationFromMatrix(int **incMatrix, int numVertices, in
  * @return The total weight of the MST.
  */
 int Kruskal::AlgorithmCalculationFromList(slistEl **adjList, int numVertices) {
-    int numEdges = 0;
-    for (int u = 0; u < numVertices; ++u) {
-        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
-            if (u < p->v) {
-                numEdges++;
-            }
-        }
-    }
+    int edgeCount;
+    Edge* edges = EdgeListBuilder::FromList(adjList, numVertices, 0, &edgeCount);
 
-    Edge* edges = new Edge[numEdges];
-    int edgeCount = 0;
-    for (int u = 0; u < numVertices; ++u) {
-        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
-            if (u < p->v) {
-                edges[edgeCount++] = {u, p->v, p->weight};
-            }
-        }
-    }
-
-    mergeSort(edges, 0, edgeCount - 1);
+    auto sortStart = chrono::high_resolution_clock::now();
+    lastSortStrategy = EdgeSort::Sort(edges, edgeCount, sortStrategy);
+    lastSortTime = chrono::duration<double>(chrono::high_resolution_clock::now() - sortStart).count();
 
     int *parent = new int[numVertices];
     int *rank = new int[numVertices];
@@ -246,6 +157,186 @@ int Kruskal::AlgorithmCalculationFromList(slistEl **adjList, int numVertices) {
     return mstWeight;
 }
 
+/**
+ * @brief Runs Filter-Kruskal on a graph represented as an incidence matrix.
+ *
+ * @param incMatrix The incidence matrix representation of the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param numEdges The number of edges in the graph.
+ * @return The total weight of the MST.
+ */
+int Kruskal::AlgorithmCalculationFromMatrixFilter(int **incMatrix, int numVertices, int numEdges) {
+    int edgeCount;
+    Edge* edges = EdgeListBuilder::FromMatrix(incMatrix, numVertices, numEdges, 0, &edgeCount);
+    int mstWeight = filterKruskal(edges, edgeCount, numVertices);
+    delete[] edges;
+    return mstWeight;
+}
+
+/**
+ * @brief Runs Filter-Kruskal on a graph represented as an adjacency list.
+ *
+ * @param adjList The adjacency list representation of the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @return The total weight of the MST.
+ */
+int Kruskal::AlgorithmCalculationFromListFilter(slistEl **adjList, int numVertices) {
+    int edgeCount;
+    Edge* edges = EdgeListBuilder::FromList(adjList, numVertices, 0, &edgeCount);
+    int mstWeight = filterKruskal(edges, edgeCount, numVertices);
+    delete[] edges;
+    return mstWeight;
+}
+
+/**
+ * @brief Executes Kruskal's algorithm on a prepared edge array, e.g. one shared through EdgeListBuilder.
+ *
+ * A sorted array is only scanned, stopping as soon as the tree has V - 1 edges, so several runs can share one
+ * sort. An unsorted array is copied and handed to Filter-Kruskal.
+ *
+ * @param edges The edges; left unchanged.
+ * @param edgeCount The number of edges.
+ * @param numVertices The number of vertices in the graph.
+ * @param sorted True if the edges are already in weight order.
+ * @return The total weight of the MST.
+ */
+int Kruskal::AlgorithmCalculationFromEdges(const Edge *edges, int edgeCount, int numVertices, bool sorted) {
+    if (!sorted) {
+        Edge* copy = new Edge[edgeCount > 0 ? edgeCount : 1];
+        std::copy(edges, edges + edgeCount, copy);
+        int mstWeight = filterKruskal(copy, edgeCount, numVertices);
+        delete[] copy;
+        return mstWeight;
+    }
+
+    int *parent = new int[numVertices];
+    int *rank = new int[numVertices];
+    for (int i = 0; i < numVertices; ++i) {
+        parent[i] = i;
+        rank[i] = 0;
+    }
+    int mstWeight = 0;
+    delete[] mst;
+    mst = new Edge[numVertices > 1 ? numVertices - 1 : 1];
+    mstSize = 0;
+    acceptSorted(edges, 0, edgeCount, parent, rank, numVertices - 1, mstWeight);
+    delete[] parent;
+    delete[] rank;
+    return mstWeight;
+}
+
+/**
+ * @brief Runs Filter-Kruskal on an edge array, filling mst and mstSize.
+ *
+ * @param edges The edges; reordered in place.
+ * @param edgeCount The number of edges.
+ * @param numVertices The number of vertices in the graph.
+ * @return The total weight of the MST.
+ */
+int Kruskal::filterKruskal(Edge *edges, int edgeCount, int numVertices) {
+    int *parent = new int[numVertices];
+    int *rank = new int[numVertices];
+    for (int i = 0; i < numVertices; ++i) {
+        parent[i] = i;
+        rank[i] = 0;
+    }
+
+    int mstWeight = 0;
+    delete[] mst;
+    mst = new Edge[numVertices > 1 ? numVertices - 1 : 1];
+    mstSize = 0;
+    lastSortedEdges = 0;
+    lastFilteredEdges = 0;
+    lastSortTime = 0;
+    filterRange(edges, 0, edgeCount, parent, rank, numVertices - 1, mstWeight);
+
+    delete[] parent;
+    delete[] rank;
+    return mstWeight;
+}
+
+/**
+ * @brief Processes edges[left, right) in weight order, partitioning and filtering large ranges.
+ *
+ * A large range is split three ways around a median-of-three pivot weight. The light part is processed first;
+ * the edges equal to the pivot need no sorting; from the heavy part every edge whose ends are already connected
+ * is dropped before it is processed. Once the tree has V - 1 edges nothing else is looked at, so on dense graphs
+ * most heavy edges are neither sorted nor even filtered.
+ *
+ * @param edges The edges.
+ * @param left The first index of the range.
+ * @param right One past the last index of the range.
+ * @param parent The union-find parent array.
+ * @param rank The union-find rank array.
+ * @param treeEdges The number of edges the tree needs (V - 1).
+ * @param mstWeight The running tree weight; updated in place.
+ */
+void Kruskal::filterRange(Edge *edges, int left, int right, int *parent, int *rank, int treeEdges, int &mstWeight) {
+    if (mstSize >= treeEdges || left >= right) {
+        return;
+    }
+    if (right - left <= FILTER_THRESHOLD) {
+        auto sortStart = chrono::high_resolution_clock::now();
+        lastSortStrategy = EdgeSort::Sort(edges + left, right - left, sortStrategy, 1);
+        lastSortTime += chrono::duration<double>(chrono::high_resolution_clock::now() - sortStart).count();
+        lastSortedEdges += right - left;
+        acceptSorted(edges, left, right, parent, rank, treeEdges, mstWeight);
+        return;
+    }
+
+    int a = edges[left].weight, b = edges[left + (right - left) / 2].weight, c = edges[right - 1].weight;
+    int pivot = max(min(a, b), min(max(a, b), c));
+    int lt = left, i = left, gt = right;
+    while (i < gt) {
+        if (edges[i].weight < pivot) {
+            swap(edges[lt++], edges[i++]);
+        } else if (edges[i].weight > pivot) {
+            swap(edges[i], edges[--gt]);
+        } else {
+            i++;
+        }
+    }
+
+    filterRange(edges, left, lt, parent, rank, treeEdges, mstWeight);
+    acceptSorted(edges, lt, gt, parent, rank, treeEdges, mstWeight);
+    if (mstSize >= treeEdges) {
+        return;
+    }
+
+    int kept = gt;
+    for (int e = gt; e < right; e++) {
+        if (find(parent, edges[e].src) != find(parent, edges[e].dest)) {
+            edges[kept++] = edges[e];
+        }
+    }
+    lastFilteredEdges += right - kept;
+    filterRange(edges, gt, kept, parent, rank, treeEdges, mstWeight);
+}
+
+/**
+ * @brief Adds the edges of edges[left, right), already in weight order, to the tree while it is not complete.
+ *
+ * @param edges The edges.
+ * @param left The first index of the range.
+ * @param right One past the last index of the range.
+ * @param parent The union-find parent array.
+ * @param rank The union-find rank array.
+ * @param treeEdges The number of edges the tree needs (V - 1).
+ * @param mstWeight The running tree weight; updated in place.
+ */
+void Kruskal::acceptSorted(const Edge *edges, int left, int right, int *parent, int *rank, int treeEdges, int &mstWeight) {
+    for (int i = left; i < right && mstSize < treeEdges; ++i) {
+        int x = find(parent, edges[i].src);
+        int y = find(parent, edges[i].dest);
+
+        if (x != y) {
+            mstWeight += edges[i].weight;
+            Union(parent, rank, x, y);
+            mst[mstSize++] = edges[i];
+        }
+    }
+}
+
 /**
  * @brief Prints the results of Kruskal's algorithm.
  *
@@ -267,8 +358,13 @@ void Kruskal::PrintResults(int mstWeight, double elapsed) {
  * @param incMatrix The incidence matrix representation of the graph.
  * @param numVertices The number of vertices in the graph.
  * @param numEdges The number of edges in the graph.
+ * @param filter True to run Filter-Kruskal instead of sorting all edges.
  */
-void Kruskal::TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges) {
+void Kruskal::TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges, bool filter) {
+    int variant = (int) sortStrategy * 2 + (filter ? 1 : 0); // Every sort strategy is timed on its own
+    if (printCached(ResultCache::MATRIX, variant)) {
+        return;
+    }
     printf("Give number of iterations: ");
     int iterations;
     float wholeTime = 0;
@@ -277,7 +373,8 @@ void Kruskal::TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges)
     printf("\n");
     for (int i = 0; i < iterations; i++) {
         auto start = chrono::high_resolution_clock::now();
-        int mstWeight = AlgorithmCalculationFromMatrix(incMatrix, numVertices, numEdges);
+        int mstWeight = filter ? AlgorithmCalculationFromMatrixFilter(incMatrix, numVertices, numEdges)
+                               : AlgorithmCalculationFromMatrix(incMatrix, numVertices, numEdges);
         auto end = chrono::high_resolution_clock::now();
         chrono::duration<double> elapsed = end - start;
         if (iterations == 1) {
@@ -285,9 +382,16 @@ void Kruskal::TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges)
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            storeInCache(mstWeight, ResultCache::MATRIX, variant);
+        }
     }
     avgTime = wholeTime / iterations * 1000;
     cout << "Average time: " << avgTime << " ms" << endl;
+    if (iterations > 0) {
+        cout << "Edge sort: " << EdgeSort::StrategyName(lastSortStrategy) << ", " << lastSortTime * 1000
+             << " ms in the last run" << endl;
+    }
 }
 
 /**
@@ -295,8 +399,13 @@ void Kruskal::TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges)
  *
  * @param adjList The adjacency list representation of the graph.
  * @param numVertices The number of vertices in the graph.
+ * @param filter True to run Filter-Kruskal instead of sorting all edges.
  */
-void Kruskal::TimeCounterList(slistEl **adjList, int numVertices) {
+void Kruskal::TimeCounterList(slistEl **adjList, int numVertices, bool filter) {
+    int variant = (int) sortStrategy * 2 + (filter ? 1 : 0); // Every sort strategy is timed on its own
+    if (printCached(ResultCache::LIST, variant)) {
+        return;
+    }
     cout << "Give number of iterations: ";
     int iterations;
     float wholeTime = 0;
@@ -305,7 +414,8 @@ void Kruskal::TimeCounterList(slistEl **adjList, int numVertices) {
     cout << endl;
     for (int i = 0; i < iterations; i++) {
         auto start = chrono::high_resolution_clock::now();
-        int mstWeight = AlgorithmCalculationFromList(adjList, numVertices);
+        int mstWeight = filter ? AlgorithmCalculationFromListFilter(adjList, numVertices)
+                               : AlgorithmCalculationFromList(adjList, numVertices);
         auto end = chrono::high_resolution_clock::now();
         chrono::duration<double> elapsed = end - start;
         if (iterations == 1) {
@@ -313,7 +423,161 @@ void Kruskal::TimeCounterList(slistEl **adjList, int numVertices) {
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            storeInCache(mstWeight, ResultCache::LIST, variant);
+        }
     }
     avgTime = wholeTime / iterations * 1000;
     cout << "Average time: " << avgTime << " ms" << endl;
+    if (iterations > 0) {
+        cout << "Edge sort: " << EdgeSort::StrategyName(lastSortStrategy) << ", " << lastSortTime * 1000
+             << " ms in the last run" << endl;
+    }
+}
+
+/**
+ * @brief Compares the fully sorting version with Filter-Kruskal on an adjacency list.
+ *
+ * Both runs start from the same adjacency list, so the times include collecting the edges. The result cache is
+ * not used.
+ *
+ * @param adjList The adjacency list representation of the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+void Kruskal::CompareWithFilter(slistEl **adjList, int numVertices) {
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (iterations <= 0) {
+        return;
+    }
+
+    double sortTime = 0, filterTime = 0;
+    int sortWeight = 0, filterWeight = 0;
+    for (int i = 0; i < iterations; i++) {
+        auto start = chrono::high_resolution_clock::now();
+        sortWeight = AlgorithmCalculationFromList(adjList, numVertices);
+        auto end = chrono::high_resolution_clock::now();
+        sortTime += chrono::duration<double>(end - start).count();
+
+        start = chrono::high_resolution_clock::now();
+        filterWeight = AlgorithmCalculationFromListFilter(adjList, numVertices);
+        end = chrono::high_resolution_clock::now();
+        filterTime += chrono::duration<double>(end - start).count();
+    }
+
+    int edgeCount;
+    delete[] EdgeListBuilder::FromList(adjList, numVertices, 0, &edgeCount);
+    cout << "Edges: " << edgeCount << endl;
+    cout << "Full merge sort: " << sortTime / iterations * 1000 << " ms, weight " << sortWeight << endl;
+    cout << "Filter-Kruskal:  " << filterTime / iterations * 1000 << " ms, weight " << filterWeight << endl;
+    cout << "  Sorted edges: " << lastSortedEdges << ", filtered out: " << lastFilteredEdges << ", neither sorted nor filtered: "
+         << edgeCount - lastSortedEdges - lastFilteredEdges << endl;
+    if (sortWeight != filterWeight) {
+        cout << "Tree weights differ" << endl;
+    }
+}
+
+/**
+ * @brief Lets the user choose the sort strategy used by all Kruskal variants.
+ */
+void Kruskal::ChooseSortStrategy() {
+    cout << "Current edge sort: " << EdgeSort::StrategyName(sortStrategy) << endl;
+    cout << "1 - Merge sort, 2 - Counting sort, 3 - LSD radix sort, 4 - Parallel sample sort, 5 - Automatic: ";
+    int choice;
+    cin >> choice;
+    if (choice >= MERGE_SORT && choice <= AUTO_SORT) {
+        sortStrategy = (SortStrategy) choice;
+        cout << "Edge sort set to " << EdgeSort::StrategyName(sortStrategy) << endl;
+    } else {
+        cout << "Invalid choice. The strategy was not changed." << endl;
+    }
+}
+
+/**
+ * @brief Sorts the edges of an adjacency list with every strategy and compares the times.
+ *
+ * Every strategy sorts a fresh copy of the same edge array, and the result is checked to be in weight order.
+ *
+ * @param adjList The adjacency list representation of the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+void Kruskal::CompareSortStrategies(slistEl **adjList, int numVertices) {
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (iterations <= 0) {
+        return;
+    }
+
+    int edgeCount;
+    Edge* edges = EdgeListBuilder::FromList(adjList, numVertices, 0, &edgeCount);
+    Edge* work = new Edge[edgeCount > 0 ? edgeCount : 1];
+    cout << "Edges: " << edgeCount << endl;
+    printf("%-22s %-12s %-22s\n", "Strategy", "Time [ms]", "Used");
+    for (int s = MERGE_SORT; s <= AUTO_SORT; s++) {
+        double wholeTime = 0;
+        SortStrategy used = (SortStrategy) s;
+        bool sorted = true;
+        for (int i = 0; i < iterations; i++) {
+            copy(edges, edges + edgeCount, work);
+            auto start = chrono::high_resolution_clock::now();
+            used = EdgeSort::Sort(work, edgeCount, (SortStrategy) s);
+            auto end = chrono::high_resolution_clock::now();
+            wholeTime += chrono::duration<double>(end - start).count();
+            for (int e = 1; e < edgeCount; e++) {
+                if (work[e - 1].weight > work[e].weight) sorted = false;
+            }
+        }
+        printf("%-22s %-12.3f %-22s%s\n", EdgeSort::StrategyName((SortStrategy) s), wholeTime / iterations * 1000,
+               EdgeSort::StrategyName(used), sorted ? "" : "  NOT SORTED");
+    }
+    delete[] edges;
+    delete[] work;
+}
+
+/**
+ * @brief Prints the cached spanning tree for a representation, if there is one.
+ * @param representation The graph representation.
+ * @param variant The cache variant of the run, 0 for the default one.
+ * @return True if a cached result was printed.
+ */
+bool Kruskal::printCached(ResultCache::Representation representation, int variant) {
+    int mstWeight, count;
+    const ResultCache::Edge* edges;
+    if (!ResultCache::LookupSpanningTree(ResultCache::KRUSKAL, representation, &mstWeight, &edges, &count, variant)) {
+        return false;
+    }
+    delete[] mst;
+    mst = new Edge[count > 0 ? count : 1];
+    mstSize = count;
+    for (int i = 0; i < count; i++) {
+        mst[i] = {edges[i].src, edges[i].dest, edges[i].weight};
+    }
+    cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+    printf("Minimum Spanning Tree Weight: %d\n", mstWeight);
+    printf("%-10s %-10s\n", "Edge", "Weight");
+    for (int i = 0; i < mstSize; i++)
+        printf("%-4d - %-4d \t%-4d\n", mst[i].src, mst[i].dest, mst[i].weight);
+    return true;
+}
+
+/**
+ * @brief Stores the current spanning tree in the result cache.
+ * @param mstWeight The total weight of the tree.
+ * @param representation The graph representation it was computed on.
+ * @param variant The cache variant of the run, 0 for the default one.
+ */
+void Kruskal::storeInCache(int mstWeight, ResultCache::Representation representation, int variant) {
+    if (ResultCache::IsBenchmarkMode()) {
+        return;
+    }
+    ResultCache::Edge* edges = new ResultCache::Edge[mstSize > 0 ? mstSize : 1];
+    for (int i = 0; i < mstSize; i++) {
+        edges[i] = {mst[i].src, mst[i].dest, mst[i].weight};
+    }
+    ResultCache::StoreSpanningTree(ResultCache::KRUSKAL, representation, mstWeight, edges, mstSize, variant);
+    delete[] edges;
 }
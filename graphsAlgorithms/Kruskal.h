@@ -10,6 +10,7 @@
 
 
 #include "../GraphsGenerating.h"
+#include "../ResultCache.h"
 
 /**
  * @class Kruskal
@@ -27,6 +28,18 @@ public:
         int weight; ///< The weight of the edge
     };
 
+    /**
+     * @enum SortStrategy
+     * @brief How the edges are ordered by weight (see EdgeSort).
+     */
+    enum SortStrategy {
+        MERGE_SORT = 1, ///< Top-down merge sort with temporary buffers per level
+        COUNTING_SORT = 2, ///< Counting sort over the weight range
+        RADIX_SORT = 3, ///< LSD radix sort, 8 bits per pass
+        SAMPLE_SORT = 4, ///< Parallel sample sort
+        AUTO_SORT = 5 ///< Picked from the weight range, the number of edges and the number of cores
+    };
+
     static Edge* mst;
     static int mstSize;
 
@@ -50,6 +63,33 @@ public:
      */
     static int AlgorithmCalculationFromList(slistEl **adjList, int numVertices);
 
+    /**
+     * @brief Executes Filter-Kruskal on a graph represented as an incidence matrix.
+     * @param incMatrix The incidence matrix representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param numEdges The number of edges in the graph.
+     * @return The total weight of the minimum spanning tree.
+     */
+    static int AlgorithmCalculationFromMatrixFilter(int **incMatrix, int numVertices, int numEdges);
+
+    /**
+     * @brief Executes Filter-Kruskal on a graph represented as an adjacency list.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @return The total weight of the minimum spanning tree.
+     */
+    static int AlgorithmCalculationFromListFilter(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Executes Kruskal's algorithm on a prepared edge array, e.g. one shared through EdgeListBuilder.
+     * @param edges The edges; left unchanged.
+     * @param edgeCount The number of edges.
+     * @param numVertices The number of vertices in the graph.
+     * @param sorted True if the edges are already in weight order; otherwise Filter-Kruskal runs on a copy.
+     * @return The total weight of the minimum spanning tree.
+     */
+    static int AlgorithmCalculationFromEdges(const Edge *edges, int edgeCount, int numVertices, bool sorted);
+
     /**
      * @brief Prints the results of Kruskal's algorithm.
      * @param mstWeight The total weight of the minimum spanning tree.
@@ -62,15 +102,87 @@ public:
      * @param incMatrix The incidence matrix representing the graph.
      * @param numVertices The number of vertices in the graph.
      * @param numEdges The number of edges in the graph.
+     * @param filter True to run Filter-Kruskal instead of sorting all edges.
      */
-    static void TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges);
+    static void TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges, bool filter = false);
 
     /**
      * @brief Measures and prints the time taken by Kruskal's algorithm on a graph represented as an adjacency list.
      * @param adjList The adjacency list representing the graph.
      * @param numVertices The number of vertices in the graph.
+     * @param filter True to run Filter-Kruskal instead of sorting all edges.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices, bool filter = false);
+
+    /**
+     * @brief Compares the fully sorting version with Filter-Kruskal on an adjacency list.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
      */
-    static void TimeCounterList(slistEl **adjList, int numVertices);
+    static void CompareWithFilter(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Lets the user choose the sort strategy used by all Kruskal variants.
+     */
+    static void ChooseSortStrategy();
+
+    /**
+     * @brief Sorts the edges of an adjacency list with every strategy and compares the times.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void CompareSortStrategies(slistEl **adjList, int numVertices);
+
+    static SortStrategy sortStrategy; ///< The sort strategy used by all Kruskal variants
+    static SortStrategy lastSortStrategy; ///< The strategy the last run actually used
+    static double lastSortTime; ///< Time the last run spent sorting, in seconds
+    static long long lastSortedEdges; ///< Edges sorted by the last Filter-Kruskal run
+    static long long lastFilteredEdges; ///< Edges the last Filter-Kruskal run dropped without sorting
+
+private:
+    /**
+     * @brief Prints the cached spanning tree for a representation, if there is one.
+     * @param representation The graph representation.
+     * @param variant The cache variant of the run, 0 for the default one.
+     * @return True if a cached result was printed.
+     */
+    static bool printCached(ResultCache::Representation representation, int variant = 0);
+
+    /**
+     * @brief Stores the current spanning tree in the result cache.
+     * @param mstWeight The total weight of the tree.
+     * @param representation The graph representation it was computed on.
+     * @param variant The cache variant of the run, 0 for the default one.
+     */
+    static void storeInCache(int mstWeight, ResultCache::Representation representation, int variant = 0);
+
+    /**
+     * @brief Runs Filter-Kruskal on an edge array, filling mst and mstSize.
+     * @param edges The edges; reordered in place.
+     * @param edgeCount The number of edges.
+     * @param numVertices The number of vertices in the graph.
+     * @return The total weight of the minimum spanning tree.
+     */
+    static int filterKruskal(Edge *edges, int edgeCount, int numVertices);
+
+    /**
+     * @brief Processes edges[left, right) in weight order, partitioning and filtering large ranges.
+     * @param edges The edges.
+     * @param left The first index of the range.
+     * @param right One past the last index of the range.
+     * @param parent The union-find parent array.
+     * @param rank The union-find rank array.
+     * @param treeEdges The number of edges the tree needs (V - 1).
+     * @param mstWeight The running tree weight; updated in place.
+     */
+    static void filterRange(Edge *edges, int left, int right, int *parent, int *rank, int treeEdges, int &mstWeight);
+
+    /**
+     * @brief Adds the edges of edges[left, right), already in weight order, to the tree while it is not complete.
+     */
+    static void acceptSorted(const Edge *edges, int left, int right, int *parent, int *rank, int treeEdges, int &mstWeight);
+
+    static const int FILTER_THRESHOLD = 256; // Ranges up to this size are sorted directly
 };
 
 #endif // KRUSKAL_H
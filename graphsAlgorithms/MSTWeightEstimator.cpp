@@ -0,0 +1,221 @@
+/**
+ * @file MSTWeightEstimator.cpp
+ * @brief This file contains the implementation of the MSTWeightEstimator class.
+ */
+
+#include "MSTWeightEstimator.h"
+#include "Kruskal.h"
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * @brief Estimates the minimum spanning forest weight of a graph represented as an adjacency list.
+ *
+ * Weights are shifted by s = minWeight - 1 into [1, W'], which adds (n - c) * s to the forest weight. Every
+ * threshold interval [t_j, t_j+1) contributes (t_j+1 - t_j) * (c_t_j - c); intervals wider than one weight use
+ * the mean of c at both ends instead of c_t_j, which removes most of the bias of the left end. Each sampled
+ * vertex u yields the term n * (s * (1 - b_W) + sum_j (t_j+1 - t_j) * (b_j - b_W)), where b_j estimates 1 / |C_j(u)| and C_j(u) is
+ * the component of u among the edges of weight at most t_j + s. The estimate is the mean of these terms and the
+ * confidence interval comes from their sample variance.
+ *
+ * Components only grow with the threshold, so one BFS per sampled vertex serves all thresholds: an edge heavier
+ * than the current threshold is parked in the bucket of the first threshold that admits it. As in the original
+ * algorithm, each sample draws a random stopping size S with P(S >= k) = 1 / k, capped at thresholds / epsilon,
+ * and b_j is 1 if C_j(u) is explored completely within S vertices and 0 otherwise. This indicator has expectation
+ * 1 / |C_j(u)| (below the cap), while a BFS reaches only about ln(cap) vertices on average. The cap can only
+ * lower the component counts.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param minWeight The smallest edge weight (or a lower bound).
+ * @param maxWeight The largest edge weight (or an upper bound).
+ * @param epsilon The target relative error; it sets the threshold spacing and the BFS size cap.
+ * @param samples The number of sampled vertices.
+ * @return The estimate.
+ */
+MSTWeightEstimator::Estimate MSTWeightEstimator::EstimateFromList(slistEl **adjList, int numVertices,
+                                                                  int minWeight, int maxWeight,
+                                                                  double epsilon, int samples) {
+    Estimate estimate = {0, 0, 0, 0, 0};
+    if (numVertices <= 0 || samples <= 0) {
+        return estimate;
+    }
+    if (epsilon <= 0) epsilon = 0.05;
+    if (maxWeight < minWeight) maxWeight = minWeight;
+
+    long long shift = (long long) minWeight - 1;
+    long long range = (long long) maxWeight - shift;
+    vector<long long> thresholds;
+    if (range <= EXACT_THRESHOLDS) {
+        for (long long t = 0; t < range; t++) {
+            thresholds.push_back(t);
+        }
+    } else {
+        thresholds.push_back(0);
+        long long t = 1;
+        while (t < range) {
+            thresholds.push_back(t);
+            long long next = (long long) (t * (1 + epsilon));
+            t = next > t ? next : t + 1;
+        }
+    }
+    int numThresholds = (int) thresholds.size();
+    thresholds.push_back(range);
+    estimate.thresholds = numThresholds;
+    long long sizeCap = (long long) ceil(numThresholds / epsilon);
+
+    vector<int> mark(numVertices, 0);
+    vector<int> bfsQueue;
+    vector<double> completed(numThresholds + 1);
+    vector<vector<int>> parked(numThresholds + 1); // Vertices behind edges first admitted at every level
+    vector<int> parkedLevels;
+    auto levelOf = [&](int weight) {
+        return (int) (lower_bound(thresholds.begin(), thresholds.end(), (long long) weight - shift)
+                      - thresholds.begin());
+    };
+    double sum = 0, sumSquares = 0, componentSum = 0;
+
+    for (int sample = 1; sample <= samples; sample++) {
+        int u = (int) (((long long) rand() * ((long long) RAND_MAX + 1) + rand()) % numVertices);
+        double uniform = (rand() + 1.0) / ((double) RAND_MAX + 1.0);
+        long long stop = 1 / uniform < (double) sizeCap ? (long long) (1 / uniform) : sizeCap;
+        mark[u] = sample;
+        bfsQueue.assign(1, u);
+        size_t head = 0;
+        long long size = 1;
+        for (int l : parkedLevels) {
+            parked[l].clear();
+        }
+        parkedLevels.clear();
+
+        // Levels 0 .. numThresholds - 1 are the thresholds, the last level is the whole graph
+        int level = 0;
+        for (; level <= numThresholds && size <= stop; level++) {
+            long long limit = thresholds[level] + shift;
+            for (int v : parked[level]) {
+                if (mark[v] != sample) {
+                    mark[v] = sample;
+                    bfsQueue.push_back(v);
+                    size++;
+                }
+            }
+            while (head < bfsQueue.size() && size <= stop) {
+                int x = bfsQueue[head++];
+                for (slistEl* p = adjList[x]; p != nullptr; p = p->next) {
+                    if (mark[p->v] == sample) continue;
+                    if (p->weight <= limit) {
+                        mark[p->v] = sample;
+                        bfsQueue.push_back(p->v);
+                        size++;
+                    } else {
+                        int l = levelOf(p->weight);
+                        if (l > numThresholds) continue; // Heavier than maxWeight, never admitted
+                        if (parked[l].empty()) parkedLevels.push_back(l);
+                        parked[l].push_back(p->v);
+                    }
+                }
+            }
+            completed[level] = size <= stop ? 1.0 : 0.0;
+        }
+        for (; level <= numThresholds; level++) {
+            completed[level] = 0.0;
+        }
+        estimate.visitedVertices += (long long) bfsQueue.size();
+
+        double whole = completed[numThresholds];
+        double term = (double) shift * (1 - whole);
+        for (int j = 0; j < numThresholds; j++) {
+            long long width = thresholds[j + 1] - thresholds[j];
+            double inside = width == 1 ? completed[j] : (completed[j] + completed[j + 1]) / 2;
+            term += (double) width * (inside - whole);
+        }
+        term *= numVertices;
+        sum += term;
+        sumSquares += term * term;
+        componentSum += whole;
+    }
+
+    double mean = sum / samples;
+    double variance = samples > 1 ? (sumSquares - samples * mean * mean) / (samples - 1) : 0;
+    estimate.weight = mean;
+    estimate.halfWidth = 1.96 * sqrt(variance > 0 ? variance : 0) / sqrt((double) samples);
+    estimate.components = (double) numVertices * componentSum / samples;
+    return estimate;
+}
+
+/**
+ * @brief Compares the estimate and its confidence interval with the exact weight from Kruskal's algorithm.
+ *
+ * The weight range is read from the graph before the timed runs; a dashboard would know it in advance. Over
+ * several iterations the report shows the mean relative error and how often the interval covered the exact
+ * weight.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+void MSTWeightEstimator::TimeCounterList(slistEl **adjList, int numVertices) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Give the target relative error (e.g. 0.05): ";
+    double epsilon;
+    cin >> epsilon;
+    cout << "Give number of sampled vertices: ";
+    int samples;
+    cin >> samples;
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (iterations <= 0) iterations = 1;
+
+    int minWeight = 0, maxWeight = 0;
+    bool first = true;
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            if (first || p->weight < minWeight) minWeight = p->weight;
+            if (first || p->weight > maxWeight) maxWeight = p->weight;
+            first = false;
+        }
+    }
+
+    auto start = chrono::high_resolution_clock::now();
+    Kruskal::AlgorithmCalculationFromList(adjList, numVertices);
+    auto end = chrono::high_resolution_clock::now();
+    double exactTime = chrono::duration<double>(end - start).count();
+    long long exact = 0; // Summed again in 64 bits, the int total overflows on wide weight ranges
+    for (int i = 0; i < Kruskal::mstSize; i++) {
+        exact += Kruskal::mst[i].weight;
+    }
+
+    Estimate estimate = {0, 0, 0, 0, 0};
+    double estimateTime = 0, errorSum = 0;
+    int covered = 0;
+    for (int i = 0; i < iterations; i++) {
+        start = chrono::high_resolution_clock::now();
+        estimate = EstimateFromList(adjList, numVertices, minWeight, maxWeight, epsilon, samples);
+        end = chrono::high_resolution_clock::now();
+        estimateTime += chrono::duration<double>(end - start).count();
+        if (fabs(estimate.weight - exact) <= estimate.halfWidth) covered++;
+        if (exact != 0) errorSum += fabs(estimate.weight - exact) / fabs((double) exact);
+    }
+    estimateTime /= iterations;
+
+    printf("Weights: %d .. %d, thresholds: %d, vertices reached by the BFS runs: %lld\n", minWeight, maxWeight,
+           estimate.thresholds, estimate.visitedVertices);
+    printf("Estimated weight: %.1f +- %.1f (95%% CI), components: %.1f\n", estimate.weight, estimate.halfWidth,
+           estimate.components);
+    printf("Exact weight (Kruskal): %lld, components: %d\n", exact, numVertices - Kruskal::mstSize);
+    printf("Mean relative error: %.2f%%, exact weight inside the interval in %d of %d runs\n",
+           100.0 * errorSum / iterations, covered, iterations);
+    printf("Estimator time: %.3f ms, Kruskal time: %.3f ms, speedup %.1fx\n", estimateTime * 1000,
+           exactTime * 1000, estimateTime > 0 ? exactTime / estimateTime : 0.0);
+}
@@ -0,0 +1,60 @@
+/**
+ * @file MSTWeightEstimator.h
+ * @brief This file contains the declaration of the MSTWeightEstimator class.
+ */
+
+#ifndef MSTWEIGHTESTIMATOR_H
+#define MSTWEIGHTESTIMATOR_H
+
+#include "../GraphsGenerating.h"
+
+/**
+ * @class MSTWeightEstimator
+ * @brief Class estimating the weight of the minimum spanning forest from a sample of vertices.
+ *
+ * Follows Chazelle, Rubinfeld and Trevisan: with integer weights in [1, W], the forest weight equals
+ * n - W * c + sum over i = 1 .. W - 1 of c_i, where c_i is the number of components of the subgraph of edges
+ * with weight at most i and c the number of components of the whole graph. Each c_i is n times the mean of
+ * 1 / |component of u| over random vertices u; that fraction is estimated by a BFS that stops after a random
+ * number of vertices. Wide weight ranges use geometrically spaced thresholds instead of every integer.
+ * The cost depends on the sample size, the cap and the degrees, not on the size of the graph.
+ */
+class MSTWeightEstimator {
+public:
+    /**
+     * @struct Estimate
+     * @brief The result of one estimation.
+     */
+    struct Estimate {
+        double weight; ///< The estimated forest weight
+        double halfWidth; ///< Half width of the 95% confidence interval from the sampling variance
+        double components; ///< The estimated number of connected components
+        int thresholds; ///< The number of weight thresholds used
+        long long visitedVertices; ///< Vertices reached by all bounded BFS runs together
+    };
+
+    /**
+     * @brief Estimates the minimum spanning forest weight of a graph represented as an adjacency list.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param minWeight The smallest edge weight (or a lower bound).
+     * @param maxWeight The largest edge weight (or an upper bound).
+     * @param epsilon The target relative error; it sets the threshold spacing and the BFS size cap.
+     * @param samples The number of sampled vertices.
+     * @return The estimate.
+     */
+    static Estimate EstimateFromList(slistEl **adjList, int numVertices, int minWeight, int maxWeight,
+                                     double epsilon, int samples);
+
+    /**
+     * @brief Compares the estimate and its confidence interval with the exact weight from Kruskal's algorithm.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices);
+
+private:
+    static const int EXACT_THRESHOLDS = 64; // Weight ranges up to this size use every integer threshold
+};
+
+#endif // MSTWEIGHTESTIMATOR_H
@@ -0,0 +1,276 @@
+/**
+ * @file NegativeCycleDetector.cpp
+ * @brief This file contains the implementation of the NegativeCycleDetector class.
+ */
+
+#include "NegativeCycleDetector.h"
+#include "BellmanFord.h"
+#include <iostream>
+#include <climits>
+#include <cstdlib>
+#include <chrono>
+#include <algorithm>
+
+using namespace std;
+
+long long NegativeCycleDetector::lastScanCount = 0;
+
+/**
+ * @brief Runs the search; with startVertex == -1 every vertex starts at distance 0.
+ *
+ * The tree is a doubly linked list in preorder, so the subtree of v is the run of vertices after v whose depth is
+ * greater than depth[v]. A virtual root with index numVertices heads the list; in the all-sources mode every
+ * vertex starts as its child.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param startVertex The starting vertex, or -1 for all vertices.
+ * @param dist Optional output array of shortest distances.
+ * @param prev Optional output array of previous vertices.
+ * @return The vertices of a negative cycle in path order, or an empty vector if there is none.
+ */
+vector<int> NegativeCycleDetector::search(slistEl **adjList, int numVertices, int startVertex, int *dist, int *prev) {
+    int root = numVertices;
+    int* distance = new int[numVertices + 1];
+    int* parent = new int[numVertices + 1];
+    int* depth = new int[numVertices + 1];
+    int* before = new int[numVertices + 1]; // Preorder list links
+    int* after = new int[numVertices + 1];
+    bool* inTree = new bool[numVertices + 1];
+    bool* inQueue = new bool[numVertices];
+    int* queue = new int[numVertices];
+    int head = 0, size = 0;
+
+    for (int v = 0; v <= numVertices; v++) {
+        distance[v] = INT_MAX;
+        parent[v] = -1;
+        depth[v] = 0;
+        before[v] = -1;
+        after[v] = -1;
+        inTree[v] = false;
+    }
+    for (int v = 0; v < numVertices; v++) {
+        inQueue[v] = false;
+    }
+    inTree[root] = true;
+    int last = root;
+    for (int v = 0; v < numVertices; v++) {
+        if (startVertex != -1 && v != startVertex) continue;
+        distance[v] = 0;
+        parent[v] = root;
+        depth[v] = 1;
+        inTree[v] = true;
+        before[v] = last;
+        after[last] = v;
+        last = v;
+        queue[(head + size++) % numVertices] = v;
+        inQueue[v] = true;
+    }
+
+    vector<int> cycle;
+    lastScanCount = 0;
+    while (size > 0 && cycle.empty()) {
+        int u = queue[head];
+        head = (head + 1) % numVertices;
+        size--;
+        inQueue[u] = false;
+        if (!inTree[u]) continue; // Dropped with a dissolved subtree; it comes back once its distance improves
+        lastScanCount++;
+
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            int v = p->v;
+            if (distance[u] + p->weight >= distance[v]) continue;
+
+            // Dissolve the subtree of v; finding u inside it closes a negative cycle
+            if (inTree[v]) {
+                int x = after[v];
+                while (x != -1 && depth[x] > depth[v]) {
+                    if (x == u) {
+                        for (int w = u; w != v; w = parent[w]) {
+                            cycle.push_back(w);
+                        }
+                        cycle.push_back(v);
+                        reverse(cycle.begin(), cycle.end());
+                        break;
+                    }
+                    inTree[x] = false;
+                    x = after[x];
+                }
+                if (!cycle.empty()) break;
+                if (v == u) {
+                    cycle.push_back(v);
+                    break;
+                }
+                // Unlink v and its former subtree (the run before x) from the preorder list
+                int previous = before[v];
+                after[previous] = x;
+                if (x != -1) before[x] = previous;
+            } else if (v == u) {
+                cycle.push_back(v);
+                break;
+            }
+
+            distance[v] = distance[u] + p->weight;
+            parent[v] = u;
+            depth[v] = depth[u] + 1;
+            inTree[v] = true;
+            after[v] = after[u];
+            if (after[u] != -1) before[after[u]] = v;
+            after[u] = v;
+            before[v] = u;
+            if (!inQueue[v]) {
+                queue[(head + size++) % numVertices] = v;
+                inQueue[v] = true;
+            }
+        }
+    }
+
+    if (cycle.empty()) {
+        for (int v = 0; v < numVertices; v++) {
+            if (dist != nullptr) dist[v] = distance[v];
+            if (prev != nullptr) prev[v] = parent[v] == root ? -1 : parent[v];
+        }
+    }
+    delete[] distance;
+    delete[] parent;
+    delete[] depth;
+    delete[] before;
+    delete[] after;
+    delete[] inTree;
+    delete[] inQueue;
+    delete[] queue;
+    return cycle;
+}
+
+/**
+ * @brief Searches for a negative cycle reachable from a start vertex.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param startVertex The starting vertex.
+ * @param dist Optional output array of shortest distances, valid if no cycle is found.
+ * @param prev Optional output array of previous vertices, valid if no cycle is found.
+ * @return The vertices of a negative cycle in path order, or an empty vector if there is none.
+ */
+vector<int> NegativeCycleDetector::FindCycle(slistEl **adjList, int numVertices, int startVertex, int *dist, int *prev) {
+    return search(adjList, numVertices, startVertex, dist, prev);
+}
+
+/**
+ * @brief Searches for a negative cycle anywhere in the graph, as if a virtual source reached every vertex.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @return The vertices of a negative cycle in path order, or an empty vector if there is none.
+ */
+vector<int> NegativeCycleDetector::FindAnyCycle(slistEl **adjList, int numVertices) {
+    return search(adjList, numVertices, -1, nullptr, nullptr);
+}
+
+/**
+ * @brief Prints a cycle as "a -> b -> ... -> a" together with its weight.
+ * @param adjList The adjacency list representing the graph.
+ * @param cycle The vertices of the cycle in path order.
+ */
+void NegativeCycleDetector::PrintCycle(slistEl **adjList, const vector<int> &cycle) {
+    if (cycle.empty()) {
+        cout << "No negative-weight cycle" << endl;
+        return;
+    }
+    long long weight = 0;
+    for (size_t i = 0; i < cycle.size(); i++) {
+        int u = cycle[i];
+        int v = cycle[(i + 1) % cycle.size()];
+        int best = INT_MAX;
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            if (p->v == v && p->weight < best) best = p->weight;
+        }
+        weight += best;
+        cout << u << " -> ";
+    }
+    cout << cycle[0] << " (weight " << weight << ")" << endl;
+}
+
+/**
+ * @brief Compares the detector with the Bellman-Ford sweeps, on the graph and with a planted negative cycle.
+ *
+ * The planted cycle joins three random vertices, the first of which gets an edge from the start vertex, so it
+ * is always reachable. Both searches report the time they needed to reach their verdict. Planting and removing
+ * the cycle each bump the graph version, so no cached result is shared with the modified graph.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param startVertex The starting vertex.
+ */
+void NegativeCycleDetector::TimeCounterList(slistEl **adjList, int numVertices, int startVertex) {
+    if (numVertices < 3) {
+        cout << "The graph needs at least 3 vertices" << endl;
+        return;
+    }
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (iterations <= 0) {
+        return;
+    }
+
+    int a = rand() % numVertices, b, c;
+    do { b = rand() % numVertices; } while (b == a);
+    do { c = rand() % numVertices; } while (c == a || c == b);
+    int heads[4] = {startVertex, a, b, c};
+    slistEl* oldHeads[4];
+    slistEl* planted[4] = {};
+
+    int* dist = new int[numVertices];
+    int* prev = new int[numVertices];
+    for (int k = 0; k < 2; k++) {
+        if (k == 0) {
+            cout << "Graph as loaded:" << endl;
+        } else {
+            // The planted edges are pushed in front of the existing lists and unlinked again afterwards
+            for (int i = 0; i < 4; i++) {
+                oldHeads[i] = adjList[heads[i]];
+            }
+            int targets[4] = {a, b, c, a};
+            int weights[4] = {1, -5, -5, -5};
+            for (int i = 0; i < 4; i++) {
+                planted[i] = new slistEl{targets[i], weights[i], adjList[heads[i]]};
+                adjList[heads[i]] = planted[i];
+            }
+            GraphsGenerating::markModified();
+            cout << "With a planted cycle " << a << " -> " << b << " -> " << c << " -> " << a << ":" << endl;
+        }
+
+        double detectorTime = 0, sweepTime = 0;
+        vector<int> cycle;
+        bool sweepOk = true;
+        int passCount = 0;
+        for (int i = 0; i < iterations; i++) {
+            auto start = chrono::high_resolution_clock::now();
+            cycle = FindCycle(adjList, numVertices, startVertex, dist, prev);
+            auto end = chrono::high_resolution_clock::now();
+            detectorTime += chrono::duration<double>(end - start).count();
+
+            start = chrono::high_resolution_clock::now();
+            sweepOk = BellmanFord::AlgorithmCalculationFromList(adjList, numVertices, startVertex, dist, prev, &passCount);
+            end = chrono::high_resolution_clock::now();
+            sweepTime += chrono::duration<double>(end - start).count();
+        }
+        cout << "  Subtree disassembly: " << detectorTime / iterations * 1000 << " ms, " << lastScanCount
+             << " vertex scans" << endl;
+        cout << "  Bellman-Ford sweeps: " << sweepTime / iterations * 1000 << " ms, " << passCount
+             << " passes" << endl;
+        cout << "  Cycle: ";
+        PrintCycle(adjList, cycle);
+        if (cycle.empty() == !sweepOk) {
+            cout << "  The verdicts of the two searches differ" << endl;
+        }
+    }
+
+    for (int i = 3; i >= 0; i--) {
+        adjList[heads[i]] = oldHeads[i];
+        delete planted[i];
+    }
+    GraphsGenerating::markModified();
+    delete[] dist;
+    delete[] prev;
+}
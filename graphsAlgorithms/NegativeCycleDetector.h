@@ -0,0 +1,68 @@
+/**
+ * @file NegativeCycleDetector.h
+ * @brief This file contains the declaration of the NegativeCycleDetector class.
+ */
+
+#ifndef NEGATIVECYCLEDETECTOR_H
+#define NEGATIVECYCLEDETECTOR_H
+
+#include <vector>
+#include "../GraphsGenerating.h"
+
+/**
+ * @class NegativeCycleDetector
+ * @brief Class finding negative-weight cycles early with Tarjan's subtree disassembly.
+ *
+ * The detector runs a queue-based Bellman-Ford and keeps the shortest path tree as a preorder list with depths.
+ * When the distance of v improves through u, the subtree of v is dissolved: its vertices leave the tree and the
+ * queue, since their distances are now stale. Meeting u inside that subtree means the improvement closes a cycle
+ * of negative weight, which is reported immediately instead of after V-1 full passes.
+ */
+class NegativeCycleDetector {
+public:
+    /**
+     * @brief Searches for a negative cycle reachable from a start vertex.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param startVertex The starting vertex.
+     * @param dist Optional output array of shortest distances, valid if no cycle is found.
+     * @param prev Optional output array of previous vertices, valid if no cycle is found.
+     * @return The vertices of a negative cycle in path order, or an empty vector if there is none.
+     */
+    static std::vector<int> FindCycle(slistEl **adjList, int numVertices, int startVertex, int *dist = nullptr,
+                                      int *prev = nullptr);
+
+    /**
+     * @brief Searches for a negative cycle anywhere in the graph, as if a virtual source reached every vertex.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @return The vertices of a negative cycle in path order, or an empty vector if there is none.
+     */
+    static std::vector<int> FindAnyCycle(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Prints a cycle as "a -> b -> ... -> a" together with its weight.
+     * @param adjList The adjacency list representing the graph.
+     * @param cycle The vertices of the cycle in path order.
+     */
+    static void PrintCycle(slistEl **adjList, const std::vector<int> &cycle);
+
+    /**
+     * @brief Compares the detector with the Bellman-Ford sweeps, on the graph and with a planted negative cycle.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param startVertex The starting vertex.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices, int startVertex);
+
+    static long long lastScanCount; ///< Number of vertex scans done by the last search
+
+private:
+    /**
+     * @brief Runs the search; with startVertex == -1 every vertex starts at distance 0.
+     * @return The vertices of a negative cycle in path order, or an empty vector if there is none.
+     */
+    static std::vector<int> search(slistEl **adjList, int numVertices, int startVertex, int *dist, int *prev);
+};
+
+#endif // NEGATIVECYCLEDETECTOR_H
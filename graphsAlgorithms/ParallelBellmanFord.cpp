@@ -0,0 +1,367 @@
+/**
+ * @file ParallelBellmanFord.cpp
+ * @brief This file contains the implementation of the ParallelBellmanFord class.
+ */
+
+#include "ParallelBellmanFord.h"
+#include "BellmanFord.h"
+#include "SSSPBatchRunner.h"
+#include "ThreadBarrier.h"
+#include <iostream>
+#include <climits>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+
+using namespace std;
+
+vector<double> ParallelBellmanFord::lastRoundTimes;
+vector<int> ParallelBellmanFord::lastFrontierSizes;
+
+static const int WORDS_PER_CHUNK = 4; // A chunk of work is 4 bitmap words, i.e. 256 vertices
+
+/**
+ * @brief Packs a distance and a previous vertex so that comparing the words compares the distances first.
+ */
+static inline uint64_t pack(int dist, int prev) {
+    return ((uint64_t) ((uint32_t) dist ^ 0x80000000u) << 32) | (uint32_t) prev;
+}
+
+/**
+ * @brief Extracts the distance of a packed word.
+ */
+static inline int unpackDist(uint64_t word) {
+    return (int) ((uint32_t) (word >> 32) ^ 0x80000000u);
+}
+
+/**
+ * @brief Extracts the previous vertex of a packed word.
+ */
+static inline int unpackPrev(uint64_t word) {
+    return (int) (uint32_t) word;
+}
+
+/**
+ * @brief Runs the algorithm from one source.
+ *
+ * The calling thread works as thread 0 and does the serial step between rounds: it swaps the frontiers, counts
+ * the new frontier and decides whether to stop. A round that still improves a distance after numVertices rounds
+ * can only follow a negative cycle.
+ *
+ * @param graph The graph in CSR form.
+ * @param transposed The transposed graph, required by the pull mode (may be nullptr for push).
+ * @param startVertex The starting vertex.
+ * @param mode The propagation mode.
+ * @param numThreads The number of threads; 0 uses the hardware concurrency.
+ * @param dist Output array of shortest distances.
+ * @param prev Output array of previous vertices.
+ * @return False if a negative-weight cycle is reachable from the start vertex, true otherwise.
+ */
+bool ParallelBellmanFord::AlgorithmCalculation(const CsrGraph &graph, const CsrGraph *transposed, int startVertex,
+                                               Mode mode, int numThreads, int *dist, int *prev) {
+    int n = graph.numVertices;
+    int words = (n + 63) / 64;
+    int chunks = (words + WORDS_PER_CHUNK - 1) / WORDS_PER_CHUNK;
+    int threads = SSSPBatchRunner::ResolveThreads(numThreads);
+    if (mode == PULL && transposed == nullptr) {
+        mode = PUSH;
+    }
+
+    // Push mode state: packed (dist, prev) words updated with CAS
+    atomic<uint64_t>* state = nullptr;
+    // Pull mode state: two buffers, the current one is read and the next one written
+    int* nextDist = nullptr;
+    int* nextPrev = nullptr;
+    atomic<uint64_t>* frontier = new atomic<uint64_t>[words];
+    atomic<uint64_t>* nextFrontier = new atomic<uint64_t>[words];
+    for (int w = 0; w < words; w++) {
+        frontier[w].store(0, memory_order_relaxed);
+        nextFrontier[w].store(0, memory_order_relaxed);
+    }
+    for (int v = 0; v < n; v++) {
+        dist[v] = INT_MAX;
+        prev[v] = -1;
+    }
+    dist[startVertex] = 0;
+    if (mode == PUSH) {
+        state = new atomic<uint64_t>[n];
+        for (int v = 0; v < n; v++) {
+            state[v].store(pack(dist[v], prev[v]), memory_order_relaxed);
+        }
+    } else {
+        nextDist = new int[n];
+        nextPrev = new int[n];
+    }
+    frontier[startVertex / 64].store(1ULL << (startVertex % 64), memory_order_relaxed);
+
+    lastRoundTimes.clear();
+    lastFrontierSizes.clear();
+    lastFrontierSizes.push_back(1);
+
+    ThreadBarrier barrier(threads);
+    atomic<int> nextChunk(0);
+    bool finished = false;
+    bool negativeCycle = false;
+    int round = 0;
+    auto roundStart = chrono::high_resolution_clock::now();
+
+    auto pushChunk = [&](int firstWord, int lastWord) {
+        for (int w = firstWord; w < lastWord; w++) {
+            uint64_t bits = frontier[w].load(memory_order_relaxed);
+            while (bits) {
+                int u = w * 64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+                int du = unpackDist(state[u].load(memory_order_relaxed));
+                for (int e = graph.offsets[u]; e < graph.offsets[u + 1]; e++) {
+                    int v = graph.targets[e];
+                    uint64_t candidate = pack(du + graph.weights[e], u);
+                    uint64_t current = state[v].load(memory_order_relaxed);
+                    // Only a strictly shorter distance is an improvement; an equal distance with another prev is not
+                    while (unpackDist(candidate) < unpackDist(current)) {
+                        if (state[v].compare_exchange_weak(current, candidate, memory_order_relaxed)) {
+                            nextFrontier[v / 64].fetch_or(1ULL << (v % 64), memory_order_relaxed);
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    auto pullChunk = [&](int firstWord, int lastWord) {
+        for (int w = firstWord; w < lastWord; w++) {
+            uint64_t changed = 0;
+            int last = min(n, (w + 1) * 64);
+            for (int v = w * 64; v < last; v++) {
+                int best = dist[v];
+                int bestPrev = prev[v];
+                for (int e = transposed->offsets[v]; e < transposed->offsets[v + 1]; e++) {
+                    int u = transposed->targets[e];
+                    if (!(frontier[u / 64].load(memory_order_relaxed) >> (u % 64) & 1)) continue;
+                    int candidate = dist[u] + transposed->weights[e];
+                    if (candidate < best) {
+                        best = candidate;
+                        bestPrev = u;
+                    }
+                }
+                nextDist[v] = best;
+                nextPrev[v] = bestPrev;
+                if (best < dist[v]) {
+                    changed |= 1ULL << (v % 64);
+                }
+            }
+            // Each bitmap word belongs to exactly one chunk, so a plain store is enough
+            nextFrontier[w].store(changed, memory_order_relaxed);
+        }
+    };
+
+    auto worker = [&](int id) {
+        while (true) {
+            barrier.Wait();
+            if (finished) break;
+            while (true) {
+                int chunk = nextChunk.fetch_add(1, memory_order_relaxed);
+                if (chunk >= chunks) break;
+                int firstWord = chunk * WORDS_PER_CHUNK;
+                int lastWord = min(words, firstWord + WORDS_PER_CHUNK);
+                if (mode == PUSH) {
+                    pushChunk(firstWord, lastWord);
+                } else {
+                    pullChunk(firstWord, lastWord);
+                }
+            }
+            barrier.Wait();
+            if (id != 0) continue;
+
+            // Serial step between rounds, done by thread 0 while the others wait at the next barrier
+            round++;
+            int frontierSize = 0;
+            for (int w = 0; w < words; w++) {
+                frontierSize += __builtin_popcountll(nextFrontier[w].load(memory_order_relaxed));
+                frontier[w].store(nextFrontier[w].load(memory_order_relaxed), memory_order_relaxed);
+                if (mode == PUSH) {
+                    nextFrontier[w].store(0, memory_order_relaxed);
+                }
+            }
+            if (mode == PULL) {
+                swap(dist, nextDist);
+                swap(prev, nextPrev);
+            }
+            auto now = chrono::high_resolution_clock::now();
+            lastRoundTimes.push_back(chrono::duration<double>(now - roundStart).count());
+            roundStart = now;
+            if (frontierSize == 0) {
+                finished = true;
+            } else if (round >= n) {
+                finished = true;
+                negativeCycle = true;
+            } else {
+                lastFrontierSizes.push_back(frontierSize);
+            }
+            nextChunk.store(0, memory_order_relaxed);
+        }
+    };
+
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++) {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for (thread &t : pool) {
+        t.join();
+    }
+
+    if (mode == PUSH) {
+        for (int v = 0; v < n; v++) {
+            uint64_t word = state[v].load(memory_order_relaxed);
+            dist[v] = unpackDist(word);
+            prev[v] = unpackPrev(word);
+        }
+        delete[] state;
+    } else {
+        // After an odd number of swaps the result sits in the buffer that was allocated here
+        if (round % 2 == 1) {
+            for (int v = 0; v < n; v++) {
+                nextDist[v] = dist[v];
+                nextPrev[v] = prev[v];
+            }
+            swap(dist, nextDist);
+            swap(prev, nextPrev);
+        }
+        delete[] nextDist;
+        delete[] nextPrev;
+    }
+    delete[] frontier;
+    delete[] nextFrontier;
+    return !negativeCycle;
+}
+
+/**
+ * @brief Cross-checks both modes against the serial algorithm on a small graph with a zero-weight cycle.
+ *
+ * The cycle 0 -> 1 -> 2 -> 0 leads back to the source with distance 0, which must neither replace the source's
+ * previous vertex nor be reported as a negative-weight cycle.
+ *
+ * @return True if both modes agree with the serial algorithm.
+ */
+static bool zeroWeightCycleCheck() {
+    const int n = 4;
+    const int edges[5][3] = {{0, 1, 0}, {1, 2, 0}, {2, 0, 0}, {1, 3, 5}, {3, 1, -2}};
+    slistEl** adjList = new slistEl*[n];
+    for (int v = 0; v < n; v++) adjList[v] = nullptr;
+    for (const auto &edge : edges) {
+        slistEl* element = new slistEl;
+        element->v = edge[1];
+        element->weight = edge[2];
+        element->next = adjList[edge[0]];
+        adjList[edge[0]] = element;
+    }
+
+    int expected[n], expectedPrev[n], dist[n], prev[n];
+    bool expectedOk = BellmanFord::AlgorithmCalculationFromListQueue(adjList, n, 0, expected, expectedPrev);
+    CsrGraph graph(adjList, n);
+    CsrGraph transposed(adjList, n, true);
+    bool agree = true;
+    ParallelBellmanFord::Mode modes[2] = {ParallelBellmanFord::PUSH, ParallelBellmanFord::PULL};
+    for (ParallelBellmanFord::Mode mode : modes) {
+        bool ok = ParallelBellmanFord::AlgorithmCalculation(graph, &transposed, 0, mode, 1, dist, prev);
+        if (ok != expectedOk || prev[0] != -1) agree = false;
+        for (int v = 0; v < n && ok; v++) {
+            if (dist[v] != expected[v]) agree = false;
+        }
+    }
+
+    for (int v = 0; v < n; v++) {
+        while (adjList[v]) {
+            slistEl* next = adjList[v]->next;
+            delete adjList[v];
+            adjList[v] = next;
+        }
+    }
+    delete[] adjList;
+    return agree;
+}
+
+/**
+ * @brief Measures the scaling of both modes over 1, 2, 4, ... threads and prints per-round times.
+ *
+ * The CSR form and its transpose are built once. Every run is checked against the serial queue-based
+ * Bellman-Ford, and the per-round times of the run with the most threads are printed for both modes. Both modes
+ * are first cross-checked on a small graph with a zero-weight cycle through the source.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param startVertex The starting vertex.
+ */
+void ParallelBellmanFord::TimeCounterList(slistEl **adjList, int numVertices, int startVertex) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Give the maximum number of threads (e.g. 64): ";
+    int maxThreads;
+    cin >> maxThreads;
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (maxThreads <= 0) maxThreads = 1;
+    if (iterations <= 0) iterations = 1;
+    if (!zeroWeightCycleCheck()) {
+        cout << "Zero-weight cycle check: push/pull differ from the serial algorithm" << endl;
+    }
+
+    CsrGraph graph(adjList, numVertices);
+    CsrGraph transposed(adjList, numVertices, true);
+    int* expected = new int[numVertices];
+    int* dist = new int[numVertices];
+    int* prev = new int[numVertices];
+    bool expectedOk = BellmanFord::AlgorithmCalculationFromListQueue(adjList, numVertices, startVertex, expected, prev);
+
+    Mode modes[2] = {PUSH, PULL};
+    const char* names[2] = {"Push (atomic fetch-min)", "Pull (in-edge gather)"};
+    for (int m = 0; m < 2; m++) {
+        cout << names[m] << ":" << endl;
+        printf("%-10s %-12s %-10s %-8s\n", "Threads", "Time [ms]", "Speedup", "Rounds");
+        double baseTime = 0;
+        for (int threads = 1; threads <= maxThreads; threads *= 2) {
+            double wholeTime = 0;
+            bool ok = true;
+            for (int i = 0; i < iterations; i++) {
+                auto start = chrono::high_resolution_clock::now();
+                ok = AlgorithmCalculation(graph, &transposed, startVertex, modes[m], threads, dist, prev);
+                auto end = chrono::high_resolution_clock::now();
+                wholeTime += chrono::duration<double>(end - start).count();
+            }
+            double avgTime = wholeTime / iterations * 1000;
+            if (threads == 1) baseTime = avgTime;
+            printf("%-10d %-12.3f %-10.2f %-8d\n", threads, avgTime, baseTime / avgTime, (int) lastRoundTimes.size());
+
+            int mismatches = 0;
+            for (int v = 0; v < numVertices && ok && expectedOk; v++) {
+                if (dist[v] != expected[v]) mismatches++;
+            }
+            if (ok != expectedOk) {
+                cout << "Negative-cycle verdict differs from the serial algorithm" << endl;
+            } else if (mismatches > 0) {
+                cout << "Distance mismatches: " << mismatches << endl;
+            }
+            if (threads * 2 > maxThreads) break;
+        }
+        if (!expectedOk) {
+            cout << "Graph contains a negative-weight cycle" << endl;
+        }
+        cout << "Per-round times of the last run:" << endl;
+        printf("%-8s %-12s %-10s\n", "Round", "Frontier", "Time [ms]");
+        for (size_t r = 0; r < lastRoundTimes.size(); r++) {
+            int frontierSize = r < lastFrontierSizes.size() ? lastFrontierSizes[r] : 0;
+            printf("%-8d %-12d %-10.4f\n", (int) r + 1, frontierSize, lastRoundTimes[r] * 1000);
+        }
+        cout << endl;
+    }
+
+    delete[] expected;
+    delete[] dist;
+    delete[] prev;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file ParallelBellmanFord.h
+ * @brief This file contains the declaration of the ParallelBellmanFord class.
+ */
+
+#ifndef PARALLELBELLMANFORD_H
+#define PARALLELBELLMANFORD_H
+
+#include <vector>
+#include "../GraphsGenerating.h"
+#include "CsrGraph.h"
+
+/**
+ * @class ParallelBellmanFord
+ * @brief Class implementing a multi-threaded, frontier-driven Bellman-Ford algorithm.
+ *
+ * Every round only touches edges leaving vertices that improved in the previous round; the frontier is kept as
+ * a bitmap with one bit per vertex. Two modes are available:
+ * - push: threads take ranges of frontier vertices and relax their out-edges with an atomic fetch-min on a packed
+ *   (distance, previous vertex) word, so parallel writers to the same vertex never lose an update;
+ * - pull: threads take ranges of vertices and gather over their in-edges from the transposed graph into a second
+ *   distance buffer. Every vertex is written by one thread only, so no atomics are needed.
+ */
+class ParallelBellmanFord {
+public:
+    /**
+     * @enum Mode
+     * @brief How a round propagates distances.
+     */
+    enum Mode {
+        PUSH = 1, ///< Relax out-edges with an atomic fetch-min
+        PULL = 2 ///< Gather over in-edges into a double buffer
+    };
+
+    /**
+     * @brief Runs the algorithm from one source.
+     * @param graph The graph in CSR form.
+     * @param transposed The transposed graph, required by the pull mode (may be nullptr for push).
+     * @param startVertex The starting vertex.
+     * @param mode The propagation mode.
+     * @param numThreads The number of threads; 0 uses the hardware concurrency.
+     * @param dist Output array of shortest distances.
+     * @param prev Output array of previous vertices.
+     * @return False if a negative-weight cycle is reachable from the start vertex, true otherwise.
+     */
+    static bool AlgorithmCalculation(const CsrGraph &graph, const CsrGraph *transposed, int startVertex, Mode mode,
+                                     int numThreads, int *dist, int *prev);
+
+    /**
+     * @brief Measures the scaling of both modes over 1, 2, 4, ... threads and prints per-round times.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param startVertex The starting vertex.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices, int startVertex);
+
+    static std::vector<double> lastRoundTimes; ///< Duration of every round of the last run, in seconds
+    static std::vector<int> lastFrontierSizes; ///< Number of frontier vertices entering every round of the last run
+};
+
+#endif // PARALLELBELLMANFORD_H
@@ -1,7 +1,16 @@
 #include "Prim.h"
+#include "Dijkstra.h"
+#include "DenseGraph.h"
+#include "SSSPBatchRunner.h"
+#include "SimdKernels.h"
+#include "ThreadBarrier.h"
 #include <iostream>
 #include <chrono>
 #include <climits>
+#include <queue>
+#include <vector>
+#include <functional>
+#include <thread>
 
 using namespace std;
 
@@ -46,38 +55,33 @@ int Prim::AlgorithmCalculationFromMatrix(int **incMatrix, int numVertices, int n
     key[0] = 0;
     int mstWeight = 0;
 
+    int* incident = new int[numEdges]; // Edges incident to the current vertex
+
     for (int count = 0; count < numVertices - 1; count++) {
         int u = minKey(key, inMST, numVertices);
         inMST[u] = true;
 
-        for (int e = 0; e < numEdges; e++) {
-            if (incMatrix[u][e] != 0) {
-                int v = -1;
-                int weight = abs(incMatrix[u][e]);
-                for (int i = 0; i < numVertices; i++) {
-                    if (i != u && incMatrix[i][e] != 0) {
-                        v = i;
-                        break;
-                    }
+        int numIncident = SimdKernels::NonZeroPositions(incMatrix[u], numEdges, incident);
+        for (int k = 0; k < numIncident; k++) {
+            int e = incident[k];
+            int v = -1;
+            int weight = abs(incMatrix[u][e]);
+            for (int i = 0; i < numVertices; i++) {
+                if (i != u && incMatrix[i][e] != 0) {
+                    v = i;
+                    break;
                 }
+            }
 
-                if (v != -1 && !inMST[v] && weight < key[v]) {
-                    key[v] = weight;
-                    parent[v] = u;
-                }
+            if (v != -1 && !inMST[v] && weight < key[v]) {
+                key[v] = weight;
+                parent[v] = u;
             }
         }
     }
+    delete[] incident;
 
-    delete[] mst;  // Clear previous MST
-    mst = new Edge[numVertices - 1];
-    mstSize = 0;
-    for (int i = 1; i < numVertices; i++) {
-        if (parent[i] != -1) {
-            mst[mstSize++] = {parent[i], i, key[i]};
-            mstWeight += key[i];
-        }
-    }
+    mstWeight = collectTree(parent, key, numVertices);
 
     delete[] key;
     delete[] parent;
@@ -107,6 +111,9 @@ void Prim::PrintResults(int mstWeight, double elapsed) {
  * @param numEdges Number of edges in the graph
  */
 void Prim::TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges) {
+    if (printCached(ResultCache::MATRIX)) {
+        return;
+    }
     cout << "Give number of iterations: ";
     int iterations;
     cin >> iterations;
@@ -125,6 +132,9 @@ void Prim::TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges) {
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            storeInCache(mstWeight, ResultCache::MATRIX);
+        }
     }
     avgTime = wholeTime / iterations * 1000;
     cout << "Average time: " << avgTime << " ms" << endl;
@@ -133,6 +143,10 @@ void Prim::TimeCounterMatrix(int **incMatrix, int numVertices, int numEdges) {
 
 /**
  * @brief Runs Prim's algorithm on a graph represented as an adjacency list
+ *
+ * The vertices outside the tree sit in an indexed binary heap ordered by key, so picking the next vertex and
+ * lowering a key both cost O(log V) and the whole run is O(E log V).
+ *
  * @param adjList Adjacency list representing the graph
  * @param numVertices Number of vertices in the graph
  * @return Weight of the minimum spanning tree
@@ -146,11 +160,111 @@ int Prim::AlgorithmCalculationFromList(slistEl **adjList, int numVertices) {
         parent[i] = -1;
         inMST[i] = false;
     }
-    key[0] = 0;
-    int mstWeight = 0;
+    PriorityQueue pq(numVertices, key);
+    if (numVertices > 0) {
+        key[0] = 0;
+        pq.push(0);
+    }
 
-    for (int count = 0; count < numVertices - 1; count++) {
+    while (!pq.isEmpty()) {
+        int u = pq.pop();
+        inMST[u] = true;
+
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            int v = p->v;
+            if (!inMST[v] && p->weight < key[v]) {
+                parent[v] = u;
+                key[v] = p->weight;
+                pq.push(v); // Inserts v or moves it up if it is already queued
+            }
+        }
+    }
+
+    int mstWeight = collectTree(parent, key, numVertices);
+
+    delete[] key;
+    delete[] parent;
+    delete[] inMST;
+    return mstWeight;
+}
+
+/**
+ * @brief Runs Prim's algorithm on an adjacency list with a lazy binary heap
+ *
+ * Instead of decreasing a key in place, every improvement pushes a new (key, vertex) entry; entries of vertices
+ * already in the tree are skipped when they reach the top. The heap may hold up to E entries, but the sift
+ * operations are simpler and no position index has to be kept.
+ *
+ * @param adjList Adjacency list representing the graph
+ * @param numVertices Number of vertices in the graph
+ * @return Weight of the minimum spanning tree
+ */
+int Prim::AlgorithmCalculationFromListLazy(slistEl **adjList, int numVertices) {
+    int* key = new int[numVertices];
+    int* parent = new int[numVertices];
+    bool* inMST = new bool[numVertices];
+    for (int i = 0; i < numVertices; i++) {
+        key[i] = INT_MAX;
+        parent[i] = -1;
+        inMST[i] = false;
+    }
+    typedef pair<int, int> Entry; // (key, vertex)
+    priority_queue<Entry, vector<Entry>, greater<Entry>> heap;
+    if (numVertices > 0) {
+        key[0] = 0;
+        heap.push({0, 0});
+    }
+
+    while (!heap.empty()) {
+        int u = heap.top().second;
+        heap.pop();
+        if (inMST[u]) continue; // Outdated entry
+        inMST[u] = true;
+
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            int v = p->v;
+            if (!inMST[v] && p->weight < key[v]) {
+                parent[v] = u;
+                key[v] = p->weight;
+                heap.push({p->weight, v});
+            }
+        }
+    }
+
+    int mstWeight = collectTree(parent, key, numVertices);
+
+    delete[] key;
+    delete[] parent;
+    delete[] inMST;
+    return mstWeight;
+}
+
+/**
+ * @brief Runs Prim's algorithm on an adjacency list with the O(V^2) minKey scan
+ *
+ * Every step scans all keys, so the run costs O(V^2 + E) whatever the density; on dense graphs this beats the
+ * heap variants because the scan is sequential and has no log factor.
+ *
+ * @param adjList Adjacency list representing the graph
+ * @param numVertices Number of vertices in the graph
+ * @return Weight of the minimum spanning tree
+ */
+int Prim::AlgorithmCalculationFromListDense(slistEl **adjList, int numVertices) {
+    int* key = new int[numVertices];
+    int* parent = new int[numVertices];
+    bool* inMST = new bool[numVertices];
+    for (int i = 0; i < numVertices; i++) {
+        key[i] = INT_MAX;
+        parent[i] = -1;
+        inMST[i] = false;
+    }
+    if (numVertices > 0) {
+        key[0] = 0;
+    }
+
+    for (int count = 0; count < numVertices; count++) {
         int u = minKey(key, inMST, numVertices);
+        if (u == -1) break; // The remaining vertices are unreachable
         inMST[u] = true;
 
         for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
@@ -162,9 +276,118 @@ int Prim::AlgorithmCalculationFromList(slistEl **adjList, int numVertices) {
         }
     }
 
-    mstWeight = 0;
+    int mstWeight = collectTree(parent, key, numVertices);
+
+    delete[] key;
+    delete[] parent;
+    delete[] inMST;
+    return mstWeight;
+}
+
+/**
+ * @brief Executes dense Prim on a weight matrix with vectorized argmin and key updates.
+ *
+ * Vertices already in the tree get key INT_MAX, so picking the next vertex is a plain argmin over the key array,
+ * and a floor array of 0 / INT_MAX keeps their keys from being lowered again. Both steps are branch-free SIMD
+ * loops, leaving the sequential read of one matrix row per step as the main cost. On large graphs every thread
+ * owns a contiguous chunk of vertices: it reduces its chunk, thread 0 picks the global minimum, and then all
+ * threads update their chunks from the chosen row.
+ *
+ * @param graph The weight matrix of the graph.
+ * @param numThreads The number of threads; 0 uses the hardware concurrency.
+ * @return The total weight of the minimum spanning tree.
+ */
+int Prim::AlgorithmCalculationFromDense(const DenseGraph &graph, int numThreads) {
+    int numVertices = graph.numVertices;
+    int* key = new int[numVertices];
+    int* parent = new int[numVertices];
+    int* floor = new int[numVertices];
+    int* treeKey = new int[numVertices];
+    for (int i = 0; i < numVertices; i++) {
+        key[i] = INT_MAX;
+        parent[i] = -1;
+        floor[i] = 0;
+        treeKey[i] = INT_MAX;
+    }
+    if (numVertices > 0) {
+        key[0] = 0;
+    }
+
+    int threads = SSSPBatchRunner::ResolveThreads(numThreads);
+    if (threads > numVertices / PARALLEL_CHUNK) threads = numVertices / PARALLEL_CHUNK;
+    if (threads < 1) threads = 1;
+
+    if (threads == 1) {
+        while (true) {
+            int u = SimdKernels::ArgMin(key, numVertices);
+            if (u == -1) break; // Done, or the remaining vertices are unreachable
+            treeKey[u] = key[u];
+            key[u] = INT_MAX;
+            floor[u] = INT_MAX;
+            SimdKernels::RelaxRow(key, parent, graph.Row(u), floor, numVertices, u);
+        }
+    } else {
+        int chunk = (numVertices / threads + 15) / 16 * 16;
+        int* localBest = new int[threads];
+        int chosen = -1;
+        ThreadBarrier barrier(threads);
+        auto worker = [&](int id) {
+            int lo = id * chunk < numVertices ? id * chunk : numVertices;
+            int hi = lo + chunk < numVertices && id < threads - 1 ? lo + chunk : numVertices;
+            while (true) {
+                int best = SimdKernels::ArgMin(key + lo, hi - lo);
+                localBest[id] = best == -1 ? -1 : lo + best;
+                barrier.Wait();
+                if (id == 0) {
+                    chosen = -1;
+                    for (int t = 0; t < threads; t++) {
+                        if (localBest[t] != -1 && (chosen == -1 || key[localBest[t]] < key[chosen])) {
+                            chosen = localBest[t];
+                        }
+                    }
+                    if (chosen != -1) {
+                        treeKey[chosen] = key[chosen];
+                        key[chosen] = INT_MAX;
+                        floor[chosen] = INT_MAX;
+                    }
+                }
+                barrier.Wait();
+                int u = chosen;
+                if (u == -1) break;
+                SimdKernels::RelaxRow(key + lo, parent + lo, graph.Row(u) + lo, floor + lo, hi - lo, u);
+            }
+        };
+        vector<thread> pool;
+        for (int t = 1; t < threads; t++) {
+            pool.emplace_back(worker, t);
+        }
+        worker(0);
+        for (thread &t : pool) {
+            t.join();
+        }
+        delete[] localBest;
+    }
+
+    int mstWeight = collectTree(parent, treeKey, numVertices);
+
+    delete[] key;
+    delete[] parent;
+    delete[] floor;
+    delete[] treeKey;
+    return mstWeight;
+}
+
+/**
+ * @brief Builds the MST edge array from the parent and key arrays and returns its weight.
+ * @param parent The parent of every vertex in the tree, -1 for the root and unreached vertices.
+ * @param key The weight of the edge to the parent of every vertex.
+ * @param numVertices The number of vertices in the graph.
+ * @return The total weight of the tree.
+ */
+int Prim::collectTree(const int *parent, const int *key, int numVertices) {
+    int mstWeight = 0;
     delete[] mst; // Clear previous MST
-    mst = new Edge[numVertices - 1];
+    mst = new Edge[numVertices > 1 ? numVertices - 1 : 1];
     mstSize = 0;
     for (int i = 1; i < numVertices; i++) {
         if (parent[i] != -1) {
@@ -172,10 +395,6 @@ int Prim::AlgorithmCalculationFromList(slistEl **adjList, int numVertices) {
             mstWeight += key[i];
         }
     }
-
-    delete[] key;
-    delete[] parent;
-    delete[] inMST;
     return mstWeight;
 }
 
@@ -184,8 +403,12 @@ int Prim::AlgorithmCalculationFromList(slistEl **adjList, int numVertices) {
  * @brief Measures and prints the time taken by Prim's algorithm on a graph represented as an adjacency list
  * @param adjList Adjacency list representing the graph
  * @param numVertices Number of vertices in the graph
+ * @param variant The way the next vertex is picked
  */
-void Prim::TimeCounterList(slistEl **adjList, int numVertices) {
+void Prim::TimeCounterList(slistEl **adjList, int numVertices, ListVariant variant) {
+    if (printCached(ResultCache::LIST, variant)) {
+        return;
+    }
     cout << "Give number of iterations: ";
     int iterations;
     cin >> iterations;
@@ -195,7 +418,14 @@ void Prim::TimeCounterList(slistEl **adjList, int numVertices) {
 
     for (int i = 0; i < iterations; i++) {
         auto start = chrono::high_resolution_clock::now();
-        int mstWeight = AlgorithmCalculationFromList(adjList, numVertices);
+        int mstWeight;
+        if (variant == LAZY_HEAP) {
+            mstWeight = AlgorithmCalculationFromListLazy(adjList, numVertices);
+        } else if (variant == DENSE_SCAN) {
+            mstWeight = AlgorithmCalculationFromListDense(adjList, numVertices);
+        } else {
+            mstWeight = AlgorithmCalculationFromList(adjList, numVertices);
+        }
         auto end = chrono::high_resolution_clock::now();
         chrono::duration<double> elapsed = end - start;
 
@@ -204,7 +434,157 @@ void Prim::TimeCounterList(slistEl **adjList, int numVertices) {
         }
         cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
         wholeTime += elapsed.count();
+        if (i == iterations - 1) {
+            storeInCache(mstWeight, ResultCache::LIST, variant);
+        }
     }
     avgTime = wholeTime / iterations * 1000;
     cout << "Average time: " << avgTime << " ms" << endl;
 }
+
+/**
+ * @brief Runs all adjacency list variants on the same graph and compares their times and tree weights
+ *
+ * The result cache is not used, so the printed times always include the computation. Repeating the comparison on
+ * graphs of growing density shows where the O(V^2) scan overtakes the heaps.
+ *
+ * @param adjList Adjacency list representing the graph
+ * @param numVertices Number of vertices in the graph
+ */
+void Prim::CompareListVariants(slistEl **adjList, int numVertices) {
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (iterations <= 0) {
+        return;
+    }
+
+    long long numArcs = 0;
+    for (int u = 0; u < numVertices; u++) {
+        for (slistEl* p = adjList[u]; p != nullptr; p = p->next) {
+            numArcs++;
+        }
+    }
+    cout << "Vertices: " << numVertices << ", edges: " << numArcs / 2 << ", density: "
+         << (numVertices > 1 ? (double) numArcs / ((double) numVertices * (numVertices - 1)) : 0.0) << endl;
+
+    const char* names[3] = {"Indexed heap", "Lazy heap", "Dense scan"};
+    int weights[3];
+    for (int k = 0; k < 3; k++) {
+        double wholeTime = 0;
+        for (int i = 0; i < iterations; i++) {
+            auto start = chrono::high_resolution_clock::now();
+            if (k == 0) {
+                weights[k] = AlgorithmCalculationFromList(adjList, numVertices);
+            } else if (k == 1) {
+                weights[k] = AlgorithmCalculationFromListLazy(adjList, numVertices);
+            } else {
+                weights[k] = AlgorithmCalculationFromListDense(adjList, numVertices);
+            }
+            auto end = chrono::high_resolution_clock::now();
+            wholeTime += chrono::duration<double>(end - start).count();
+        }
+        printf("%-14s %10.3f ms   weight %d\n", names[k], wholeTime / iterations * 1000, weights[k]);
+    }
+    if (weights[0] != weights[1] || weights[0] != weights[2]) {
+        cout << "Tree weights differ between the variants" << endl;
+    }
+}
+
+/**
+ * @brief Prints the cached spanning tree for a representation, if there is one.
+ * @param representation The graph representation.
+ * @param variant The cache variant of the run, 0 for the default one.
+ * @return True if a cached result was printed.
+ */
+bool Prim::printCached(ResultCache::Representation representation, int variant) {
+    int mstWeight, count;
+    const ResultCache::Edge* edges;
+    if (!ResultCache::LookupSpanningTree(ResultCache::PRIM, representation, &mstWeight, &edges, &count, variant)) {
+        return false;
+    }
+    delete[] mst;
+    mst = new Edge[count > 0 ? count : 1];
+    mstSize = count;
+    for (int i = 0; i < count; i++) {
+        mst[i] = {edges[i].src, edges[i].dest, edges[i].weight};
+    }
+    cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+    printf("Minimum Spanning Tree Weight: %d\n", mstWeight);
+    printf("%-10s %-10s\n", "Edge", "Weight");
+    for (int i = 0; i < mstSize; i++)
+        printf("%-4d - %-4d \t%-4d\n", mst[i].src, mst[i].dest, mst[i].weight);
+    return true;
+}
+
+/**
+ * @brief Stores the current spanning tree in the result cache.
+ * @param mstWeight The total weight of the tree.
+ * @param representation The graph representation it was computed on.
+ * @param variant The cache variant of the run, 0 for the default one.
+ */
+void Prim::storeInCache(int mstWeight, ResultCache::Representation representation, int variant) {
+    if (ResultCache::IsBenchmarkMode()) {
+        return;
+    }
+    ResultCache::Edge* edges = new ResultCache::Edge[mstSize > 0 ? mstSize : 1];
+    for (int i = 0; i < mstSize; i++) {
+        edges[i] = {mst[i].src, mst[i].dest, mst[i].weight};
+    }
+    ResultCache::StoreSpanningTree(ResultCache::PRIM, representation, mstWeight, edges, mstSize, variant);
+    delete[] edges;
+}
+
+/**
+ * @brief Measures dense Prim on the weight matrix of the graph and compares it with the scalar minKey scan
+ *
+ * The effective bandwidth counts one matrix row (4 V bytes) per step, which is what the run is bound by once the
+ * argmin and key updates are vectorized.
+ *
+ * @param adjList Adjacency list representing the graph
+ * @param numVertices Number of vertices in the graph
+ */
+void Prim::TimeCounterDense(slistEl **adjList, int numVertices) {
+    cout << "Give number of threads (0 - all cores): ";
+    int numThreads;
+    cin >> numThreads;
+    cout << "Give number of iterations: ";
+    int iterations;
+    cin >> iterations;
+    cout << endl;
+    if (iterations <= 0) {
+        return;
+    }
+
+    auto start = chrono::high_resolution_clock::now();
+    DenseGraph graph(adjList, numVertices);
+    auto end = chrono::high_resolution_clock::now();
+    cout << "Weight matrix built in " << chrono::duration<double>(end - start).count() * 1000 << " ms ("
+         << (double) numVertices * numVertices * sizeof(int) / (1024 * 1024) << " MB)" << endl;
+
+    float wholeTime = 0;
+    int mstWeight = 0;
+    for (int i = 0; i < iterations; i++) {
+        start = chrono::high_resolution_clock::now();
+        mstWeight = AlgorithmCalculationFromDense(graph, numThreads);
+        end = chrono::high_resolution_clock::now();
+        chrono::duration<double> elapsed = end - start;
+
+        if (iterations == 1) {
+            PrintResults(mstWeight, elapsed.count() * 1000);
+        }
+        cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
+        wholeTime += elapsed.count();
+    }
+    double avgTime = wholeTime / iterations;
+    cout << "Average time: " << avgTime * 1000 << " ms" << endl;
+    cout << "Kernel: " << SimdKernels::LevelName(SimdKernels::ActiveLevel()) << ", effective bandwidth: "
+         << (double) numVertices * numVertices * sizeof(int) / avgTime / 1e9 << " GB/s" << endl;
+
+    start = chrono::high_resolution_clock::now();
+    int scalarWeight = AlgorithmCalculationFromListDense(adjList, numVertices);
+    end = chrono::high_resolution_clock::now();
+    cout << "Scalar minKey scan on the list: " << chrono::duration<double>(end - start).count() * 1000 << " ms";
+    cout << (scalarWeight == mstWeight ? ", same weight" : ", different weight: " + to_string(scalarWeight)) << endl;
+}
@@ -7,6 +7,9 @@
 #define PRIM_H
 
 #include "../GraphsGenerating.h" // Ensure this path is correct and accessible
+#include "../ResultCache.h"
+
+class DenseGraph;
 
 /**
  * @class Prim
@@ -14,6 +17,16 @@
  */
 class Prim {
 public:
+    /**
+     * @enum ListVariant
+     * @brief The way the adjacency list version picks the next vertex.
+     */
+    enum ListVariant {
+        INDEXED_HEAP = 1, ///< Binary heap with decrease-key, O(E log V)
+        LAZY_HEAP = 2, ///< Binary heap that keeps outdated entries and skips them when popped, O(E log E)
+        DENSE_SCAN = 3 ///< Linear minKey scan over all vertices, O(V^2)
+    };
+
     /**
      * @struct Edge
      * @brief Struct representing an edge in a graph.
@@ -42,6 +55,30 @@ public:
      */
     static int AlgorithmCalculationFromList(slistEl **adjList, int numVertices);
 
+    /**
+     * @brief Executes Prim's algorithm on an adjacency list with a lazy binary heap.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @return The total weight of the minimum spanning tree.
+     */
+    static int AlgorithmCalculationFromListLazy(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Executes Prim's algorithm on an adjacency list with the O(V^2) minKey scan, suited to dense graphs.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @return The total weight of the minimum spanning tree.
+     */
+    static int AlgorithmCalculationFromListDense(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Executes dense Prim on a weight matrix with vectorized argmin and key updates.
+     * @param graph The weight matrix of the graph.
+     * @param numThreads The number of threads; 0 uses the hardware concurrency.
+     * @return The total weight of the minimum spanning tree.
+     */
+    static int AlgorithmCalculationFromDense(const DenseGraph &graph, int numThreads);
+
     /**
      * @brief Prints the results of Prim's algorithm.
      * @param mstWeight The total weight of the minimum spanning tree.
@@ -60,8 +97,23 @@ public:
      * @brief Measures and prints the time taken by Prim's algorithm on a graph represented as an adjacency list.
      * @param adjList The adjacency list representing the graph.
      * @param numVertices The number of vertices in the graph.
+     * @param variant The way the next vertex is picked.
      */
-    static void TimeCounterList(slistEl **adjList, int numVertices);
+    static void TimeCounterList(slistEl **adjList, int numVertices, ListVariant variant = INDEXED_HEAP);
+
+    /**
+     * @brief Runs all adjacency list variants on the same graph and compares their times and tree weights.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void CompareListVariants(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Measures dense Prim on the weight matrix of the graph and compares it with the scalar minKey scan.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void TimeCounterDense(slistEl **adjList, int numVertices);
 
     /**
     * @brief Finds the vertex with the minimum key value, from the set of vertices not yet included in the MST.
@@ -73,6 +125,33 @@ public:
     static int minKey(int* key, bool* inMST, int numVertices); // Ensure this is declared as static and matches the definition
 
 private:
+    /**
+     * @brief Prints the cached spanning tree for a representation, if there is one.
+     * @param representation The graph representation.
+     * @param variant The cache variant of the run, 0 for the default one.
+     * @return True if a cached result was printed.
+     */
+    static bool printCached(ResultCache::Representation representation, int variant = 0);
+
+    /**
+     * @brief Stores the current spanning tree in the result cache.
+     * @param mstWeight The total weight of the tree.
+     * @param representation The graph representation it was computed on.
+     * @param variant The cache variant of the run, 0 for the default one.
+     */
+    static void storeInCache(int mstWeight, ResultCache::Representation representation, int variant = 0);
+
+    /**
+     * @brief Builds the MST edge array from the parent and key arrays and returns its weight.
+     * @param parent The parent of every vertex in the tree, -1 for the root and unreached vertices.
+     * @param key The weight of the edge to the parent of every vertex.
+     * @param numVertices The number of vertices in the graph.
+     * @return The total weight of the tree.
+     */
+    static int collectTree(const int *parent, const int *key, int numVertices);
+
+    static const int PARALLEL_CHUNK = 16384; // Fewest vertices per thread worth a barrier per step in dense Prim
+
     static Edge* mst; // The resulting MST, stored as an array of edges
     static int mstSize; // Size of the MST array
 };
@@ -0,0 +1,555 @@
+/**
+ * @file PushRelabel.cpp
+ * @brief This file contains the implementation of the PushRelabel class.
+ */
+
+#include "PushRelabel.h"
+#include "FlowNetwork.h"
+#include "Dinic.h"
+#include "../ResultCache.h"
+#include <iostream>
+#include <chrono>
+
+using namespace std;
+
+long long PushRelabel::lastPushes = 0;
+long long PushRelabel::lastRelabels = 0;
+int PushRelabel::lastGlobalRelabels = 0;
+int PushRelabel::lastGaps = 0;
+double PushRelabel::lastPhaseOneTime = 0;
+double PushRelabel::lastPhaseTwoTime = 0;
+
+static const int GLOBAL_RELABEL_FACTOR = 6; // Relabel work allowed between global relabelings, per vertex
+static const int RELABEL_COST = 12; // Work charged to every relabel on top of the scanned arcs
+
+/**
+ * @class Preflow
+ * @brief State of one push-relabel run: labels, excesses, current arcs and the label buckets.
+ *
+ * Every vertex with a label below numVertices, other than the sink, is kept in a doubly linked bucket of its label,
+ * which makes gap detection O(1) and lets a gap lift exactly the vertices above it. Active vertices are kept in
+ * singly linked buckets per label for the highest-label rule, or in a circular queue for FIFO.
+ */
+class Preflow {
+public:
+    /**
+     * @brief Allocates the state for a run on a network without flow.
+     * @param network The residual network.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param selection The order in which active vertices are discharged.
+     */
+    Preflow(FlowNetwork &network, int source, int sink, PushRelabel::Selection selection)
+        : network(network), n(network.numVertices), source(source), sink(sink), selection(selection) {
+        label = new int[n];
+        excess = new long long[n]();
+        currentArc = new int[n];
+        bucketFirst = new int[n + 1];
+        bucketNext = new int[n];
+        bucketPrev = new int[n];
+        activeFirst = new int[n + 1];
+        activeNext = new int[n];
+        queue = new int[n];
+        queued = new bool[n]();
+        scratch = new int[n];
+        queueFront = 0;
+        queueSize = 0;
+        maxLabel = -1;
+        maxActive = -1;
+        work = 0;
+    }
+
+    /**
+     * @brief Destructor for the Preflow class.
+     */
+    ~Preflow() {
+        delete[] label;
+        delete[] excess;
+        delete[] currentArc;
+        delete[] bucketFirst;
+        delete[] bucketNext;
+        delete[] bucketPrev;
+        delete[] activeFirst;
+        delete[] activeNext;
+        delete[] queue;
+        delete[] queued;
+        delete[] scratch;
+    }
+
+    Preflow(const Preflow &) = delete;
+    Preflow &operator=(const Preflow &) = delete;
+
+    /**
+     * @brief Computes a maximum preflow.
+     * @return The excess of the sink, i.e. the maximum flow value.
+     */
+    long long RunPhaseOne() {
+        for (int a = network.offsets[source]; a < network.offsets[source + 1]; a++) {
+            int v = network.heads[a];
+            int delta = network.residual[a];
+            if (delta > 0 && v != source) {
+                network.residual[a] = 0;
+                network.residual[network.mates[a]] += delta;
+                excess[v] += delta;
+                excess[source] -= delta;
+            }
+        }
+        globalRelabel();
+        long long threshold = (long long) GLOBAL_RELABEL_FACTOR * n + network.numArcs / 2;
+        int u;
+        while ((u = popActive()) != -1) {
+            if (label[u] >= n || excess[u] == 0) continue;
+            discharge(u);
+            if (work > threshold) {
+                globalRelabel();
+            }
+        }
+        return excess[sink];
+    }
+
+    /**
+     * @brief Returns the excess left on vertices that cannot reach the sink to the source.
+     *
+     * This is a FIFO push-relabel run towards the source: labels are exact BFS distances to the source in the
+     * residual network, and the sink takes no part, so the flow value found by the first phase is kept.
+     */
+    void RunPhaseTwo() {
+        for (int v = 0; v < n; v++) {
+            label[v] = 2 * n;
+            queued[v] = false;
+            currentArc[v] = network.offsets[v];
+        }
+        int front = 0, back = 0;
+        scratch[back++] = source;
+        label[source] = 0;
+        while (front != back) {
+            int u = scratch[front++];
+            for (int a = network.offsets[u]; a < network.offsets[u + 1]; a++) {
+                int v = network.heads[a];
+                if (v != sink && label[v] == 2 * n && network.residual[network.mates[a]] > 0) {
+                    label[v] = label[u] + 1;
+                    scratch[back++] = v;
+                }
+            }
+        }
+
+        queueFront = 0;
+        queueSize = 0;
+        for (int v = 0; v < n; v++) {
+            if (v != source && v != sink && excess[v] > 0) {
+                enqueue(v);
+            }
+        }
+        while (queueSize > 0) {
+            int u = queue[queueFront];
+            queueFront = queueFront + 1 == n ? 0 : queueFront + 1;
+            queueSize--;
+            queued[u] = false;
+            while (excess[u] > 0) {
+                int end = network.offsets[u + 1];
+                int a = currentArc[u];
+                for (; a < end; a++) {
+                    int v = network.heads[a];
+                    if (v != sink && network.residual[a] > 0 && label[v] == label[u] - 1) {
+                        push(u, a);
+                        if (v != source && !queued[v]) {
+                            enqueue(v);
+                        }
+                        if (excess[u] == 0) break;
+                    }
+                }
+                currentArc[u] = a;
+                if (excess[u] == 0) break;
+
+                int newLabel = 2 * n;
+                for (int b = network.offsets[u]; b < end; b++) {
+                    int v = network.heads[b];
+                    if (v != sink && network.residual[b] > 0 && label[v] + 1 < newLabel) {
+                        newLabel = label[v] + 1;
+                        currentArc[u] = b;
+                    }
+                }
+                label[u] = newLabel;
+                PushRelabel::lastRelabels++;
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Sets every label to the exact residual distance to the sink and rebuilds the buckets.
+     */
+    void globalRelabel() {
+        PushRelabel::lastGlobalRelabels++;
+        for (int v = 0; v < n; v++) {
+            label[v] = n;
+            currentArc[v] = network.offsets[v];
+        }
+        for (int l = 0; l <= n; l++) {
+            bucketFirst[l] = -1;
+            activeFirst[l] = -1;
+        }
+        for (int i = 0; i < queueSize; i++) {
+            queued[queue[(queueFront + i) % n]] = false;
+        }
+        queueFront = 0;
+        queueSize = 0;
+        maxLabel = -1;
+        maxActive = -1;
+        work = 0;
+
+        int front = 0, back = 0;
+        scratch[back++] = sink;
+        label[sink] = 0;
+        while (front != back) {
+            int u = scratch[front++];
+            for (int a = network.offsets[u]; a < network.offsets[u + 1]; a++) {
+                int v = network.heads[a];
+                if (label[v] == n && v != source && network.residual[network.mates[a]] > 0) {
+                    label[v] = label[u] + 1;
+                    scratch[back++] = v;
+                    addToBucket(v);
+                    if (excess[v] > 0) {
+                        activate(v);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Discharges an active vertex until it has no excess or leaves the computation.
+     * @param u The vertex.
+     */
+    void discharge(int u) {
+        while (excess[u] > 0) {
+            int end = network.offsets[u + 1];
+            int a = currentArc[u];
+            for (; a < end; a++) {
+                int v = network.heads[a];
+                if (network.residual[a] > 0 && label[v] == label[u] - 1) {
+                    bool wasInactive = excess[v] == 0;
+                    push(u, a);
+                    if (wasInactive && v != sink) {
+                        activate(v);
+                    }
+                    if (excess[u] == 0) break;
+                }
+            }
+            currentArc[u] = a;
+            if (excess[u] == 0) break;
+            relabel(u);
+            if (label[u] >= n) break;
+        }
+    }
+
+    /**
+     * @brief Pushes as much excess as possible from u along an arc.
+     * @param u The tail of the arc.
+     * @param a The arc.
+     */
+    void push(int u, int a) {
+        int delta = excess[u] < network.residual[a] ? (int) excess[u] : network.residual[a];
+        network.residual[a] -= delta;
+        network.residual[network.mates[a]] += delta;
+        excess[u] -= delta;
+        excess[network.heads[a]] += delta;
+        PushRelabel::lastPushes++;
+    }
+
+    /**
+     * @brief Raises the label of u to one above its lowest residual neighbour, or applies the gap heuristic.
+     * @param u The vertex, which has no admissible arc left.
+     */
+    void relabel(int u) {
+        PushRelabel::lastRelabels++;
+        int oldLabel = label[u];
+        if (bucketFirst[oldLabel] == u && bucketNext[u] == -1) {
+            gap(oldLabel);
+            return;
+        }
+        int newLabel = n;
+        int end = network.offsets[u + 1];
+        work += RELABEL_COST + end - network.offsets[u];
+        for (int a = network.offsets[u]; a < end; a++) {
+            if (network.residual[a] > 0 && label[network.heads[a]] + 1 < newLabel) {
+                newLabel = label[network.heads[a]] + 1;
+                currentArc[u] = a;
+            }
+        }
+        removeFromBucket(u);
+        label[u] = newLabel;
+        if (newLabel < n) {
+            addToBucket(u);
+        }
+    }
+
+    /**
+     * @brief Removes every vertex with a label at or above an emptied label; none of them can reach the sink.
+     * @param gapLabel The label whose only vertex is being relabeled.
+     */
+    void gap(int gapLabel) {
+        PushRelabel::lastGaps++;
+        for (int l = gapLabel; l <= maxLabel; l++) {
+            for (int v = bucketFirst[l]; v != -1; v = bucketNext[v]) {
+                label[v] = n;
+            }
+            bucketFirst[l] = -1;
+            activeFirst[l] = -1;
+        }
+        maxLabel = gapLabel - 1;
+        if (maxActive > maxLabel) {
+            maxActive = maxLabel;
+        }
+    }
+
+    /**
+     * @brief Adds a vertex to the bucket of its label.
+     * @param v The vertex.
+     */
+    void addToBucket(int v) {
+        int l = label[v];
+        bucketPrev[v] = -1;
+        bucketNext[v] = bucketFirst[l];
+        if (bucketFirst[l] != -1) {
+            bucketPrev[bucketFirst[l]] = v;
+        }
+        bucketFirst[l] = v;
+        if (l > maxLabel) {
+            maxLabel = l;
+        }
+    }
+
+    /**
+     * @brief Removes a vertex from the bucket of its label.
+     * @param v The vertex.
+     */
+    void removeFromBucket(int v) {
+        if (bucketPrev[v] != -1) {
+            bucketNext[bucketPrev[v]] = bucketNext[v];
+        } else {
+            bucketFirst[label[v]] = bucketNext[v];
+        }
+        if (bucketNext[v] != -1) {
+            bucketPrev[bucketNext[v]] = bucketPrev[v];
+        }
+    }
+
+    /**
+     * @brief Marks a vertex that just received excess as active.
+     * @param v The vertex.
+     */
+    void activate(int v) {
+        if (label[v] >= n) return;
+        if (selection == PushRelabel::FIFO) {
+            if (!queued[v]) {
+                enqueue(v);
+            }
+            return;
+        }
+        activeNext[v] = activeFirst[label[v]];
+        activeFirst[label[v]] = v;
+        if (label[v] > maxActive) {
+            maxActive = label[v];
+        }
+    }
+
+    /**
+     * @brief Appends a vertex to the FIFO queue.
+     * @param v The vertex.
+     */
+    void enqueue(int v) {
+        int back = queueFront + queueSize;
+        queue[back >= n ? back - n : back] = v;
+        queueSize++;
+        queued[v] = true;
+    }
+
+    /**
+     * @brief Takes the next active vertex according to the selection rule.
+     * @return The vertex, or -1 if no vertex is active.
+     */
+    int popActive() {
+        if (selection == PushRelabel::FIFO) {
+            if (queueSize == 0) return -1;
+            int v = queue[queueFront];
+            queueFront = queueFront + 1 == n ? 0 : queueFront + 1;
+            queueSize--;
+            queued[v] = false;
+            return v;
+        }
+        while (maxActive >= 0 && activeFirst[maxActive] == -1) {
+            maxActive--;
+        }
+        if (maxActive < 0) return -1;
+        int v = activeFirst[maxActive];
+        activeFirst[maxActive] = activeNext[v];
+        return v;
+    }
+
+    FlowNetwork &network;
+    int n;
+    int source;
+    int sink;
+    PushRelabel::Selection selection;
+    int *label; // Distance labels; numVertices marks vertices that cannot reach the sink
+    long long *excess;
+    int *currentArc;
+    int *bucketFirst; // Vertices per label, doubly linked
+    int *bucketNext;
+    int *bucketPrev;
+    int *activeFirst; // Active vertices per label, singly linked (highest-label rule)
+    int *activeNext;
+    int *queue; // Circular queue of active vertices (FIFO rule and the second phase)
+    bool *queued;
+    int *scratch; // BFS queue of the global relabeling
+    int queueFront;
+    int queueSize;
+    int maxLabel; // Highest non-empty vertex bucket
+    int maxActive; // Upper bound on the highest non-empty active bucket
+    long long work; // Relabel work since the last global relabeling
+};
+
+/**
+ * @brief Executes the push-relabel algorithm on a residual network, starting from zero flow.
+ * @param network The residual network; it holds the maximum flow afterwards.
+ * @param source The source vertex.
+ * @param sink The sink vertex.
+ * @param selection The order in which active vertices are discharged.
+ * @return The maximum flow from source to sink.
+ */
+int PushRelabel::AlgorithmCalculation(FlowNetwork &network, int source, int sink, Selection selection) {
+    network.Reset();
+    lastPushes = 0;
+    lastRelabels = 0;
+    lastGlobalRelabels = 0;
+    lastGaps = 0;
+    lastPhaseOneTime = 0;
+    lastPhaseTwoTime = 0;
+    if (source == sink || network.numVertices <= 0) {
+        return 0;
+    }
+
+    Preflow preflow(network, source, sink, selection);
+    auto start = chrono::high_resolution_clock::now();
+    long long maxFlow = preflow.RunPhaseOne();
+    auto middle = chrono::high_resolution_clock::now();
+    preflow.RunPhaseTwo();
+    auto end = chrono::high_resolution_clock::now();
+    lastPhaseOneTime = chrono::duration<double>(middle - start).count();
+    lastPhaseTwoTime = chrono::duration<double>(end - middle).count();
+    return (int) maxFlow;
+}
+
+/**
+ * @brief Executes the push-relabel algorithm on a graph represented as an adjacency list.
+ * @param graph The adjacency list representing the graph.
+ * @param source The source vertex.
+ * @param sink The sink vertex.
+ * @param numVertices The number of vertices in the graph.
+ * @param selection The order in which active vertices are discharged.
+ * @return The maximum flow from source to sink.
+ */
+int PushRelabel::AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices,
+                                              Selection selection) {
+    FlowNetwork network(graph, numVertices);
+    return AlgorithmCalculation(network, source, sink, selection);
+}
+
+/**
+ * @brief Returns a printable name of a selection rule.
+ * @param selection The selection rule.
+ * @return The name of the rule.
+ */
+const char* PushRelabel::SelectionName(Selection selection) {
+    return selection == FIFO ? "FIFO" : "highest-label";
+}
+
+/**
+ * @brief Measures and prints the time taken by the push-relabel algorithm on a graph represented as an adjacency list.
+ *
+ * The residual network is built once and reset before every iteration. The minimum cut of the last run is stored
+ * in the result cache.
+ *
+ * @param graph The adjacency list representing the graph.
+ * @param source The source vertex.
+ * @param sink The sink vertex.
+ * @param numVertices The number of vertices in the graph.
+ * @param selection The order in which active vertices are discharged.
+ */
+void PushRelabel::TimeCounterList(slistEl **graph, int source, int sink, int numVertices, Selection selection) {
+    int cachedFlow;
+    const bool* cachedCut;
+    if (ResultCache::LookupMaxFlow(ResultCache::PUSH_RELABEL, ResultCache::LIST, source, sink, &cachedFlow, &cachedCut,
+                                   selection)) {
+        cout << "Result taken from the cache (graph version " << GraphsGenerating::graphVersion << ")" << endl;
+        printf("Max Flow: %d\n", cachedFlow);
+        return;
+    }
+    cout << "Give number of iterations: ";
+    int iterations;
+    float wholeTime = 0;
+    float avgTime;
+    cin >> iterations;
+    cout << endl;
+
+    FlowNetwork network(graph, numVertices);
+    int maxFlow = 0;
+    for (int i = 0; i < iterations; i++) {
+        auto start = chrono::high_resolution_clock::now();
+        maxFlow = AlgorithmCalculation(network, source, sink, selection);
+        auto end = chrono::high_resolution_clock::now();
+        chrono::duration<double> elapsed = end - start;
+        cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
+        wholeTime += elapsed.count();
+    }
+    if (iterations <= 0) {
+        return;
+    }
+
+    bool* sourceSide = new bool[numVertices];
+    int cutSize = network.SourceSide(source, sourceSide);
+    ResultCache::StoreMaxFlow(ResultCache::PUSH_RELABEL, ResultCache::LIST, source, sink, maxFlow, sourceSide, numVertices,
+                              selection);
+    delete[] sourceSide;
+
+    printf("Selection: %s\n", SelectionName(selection));
+    printf("Pushes: %lld, relabels: %lld, global relabelings: %d, gaps: %d\n", lastPushes, lastRelabels,
+           lastGlobalRelabels, lastGaps);
+    printf("Maximum preflow: %.3f ms, flow recovery: %.3f ms\n", lastPhaseOneTime * 1000, lastPhaseTwoTime * 1000);
+    printf("Source side of the minimum cut: %d vertices\n", cutSize);
+    printf("Max Flow: %d\n", maxFlow);
+    avgTime = wholeTime / iterations * 1000;
+    cout << "Average time: " << avgTime << " ms" << endl;
+}
+
+/**
+ * @brief Runs Dinic's algorithm and both push-relabel variants on the same residual network and compares them.
+ * @param graph The adjacency list representing the graph.
+ * @param source The source vertex.
+ * @param sink The sink vertex.
+ * @param numVertices The number of vertices in the graph.
+ */
+void PushRelabel::CompareEngines(slistEl **graph, int source, int sink, int numVertices) {
+    FlowNetwork network(graph, numVertices);
+
+    auto start = chrono::high_resolution_clock::now();
+    int dinicFlow = Dinic::AlgorithmCalculation(network, source, sink);
+    auto end = chrono::high_resolution_clock::now();
+    printf("Dinic:                       %10.3f ms, max flow %d (%d phases, %lld augmenting paths)\n",
+           chrono::duration<double>(end - start).count() * 1000, dinicFlow, Dinic::lastPhases,
+           Dinic::lastAugmentations);
+
+    Selection selections[] = {HIGHEST_LABEL, FIFO};
+    for (Selection selection : selections) {
+        start = chrono::high_resolution_clock::now();
+        int maxFlow = AlgorithmCalculation(network, source, sink, selection);
+        end = chrono::high_resolution_clock::now();
+        printf("Push-relabel %-14s  %10.3f ms, max flow %d (%lld pushes, %lld relabels, %d global, %d gaps)\n",
+               SelectionName(selection), chrono::duration<double>(end - start).count() * 1000, maxFlow, lastPushes,
+               lastRelabels, lastGlobalRelabels, lastGaps);
+        if (maxFlow != dinicFlow) {
+            cout << "The maximum flow values differ" << endl;
+        }
+    }
+}
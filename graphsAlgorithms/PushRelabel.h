@@ -0,0 +1,91 @@
+/**
+ * @file PushRelabel.h
+ * @brief This file contains the declaration of the PushRelabel class.
+ */
+
+#ifndef PUSHRELABEL_H
+#define PUSHRELABEL_H
+
+#include "../GraphsGenerating.h"
+
+class FlowNetwork;
+
+/**
+ * @class PushRelabel
+ * @brief Class implementing the push-relabel (preflow) algorithm for finding the maximum flow in a graph.
+ *
+ * The first phase computes a maximum preflow: active vertices (with excess) are discharged in highest-label or
+ * FIFO order, pushing along arcs to vertices one label lower and relabeling when no such arc is left. Labels are
+ * recomputed exactly by a reverse BFS from the sink whenever the relabel work since the last update exceeds a
+ * threshold, and the gap heuristic lifts every vertex above an emptied label out of the computation at once. At
+ * the end of the first phase the flow value and a minimum cut are known; the second phase returns the excess that
+ * could not reach the sink to the source, turning the preflow into a valid flow.
+ */
+class PushRelabel {
+public:
+    /**
+     * @enum Selection
+     * @brief Order in which active vertices are discharged.
+     */
+    enum Selection {
+        HIGHEST_LABEL = 0, ///< Always discharge an active vertex with the highest label
+        FIFO = 1 ///< Discharge active vertices in the order they became active
+    };
+
+    static long long lastPushes; ///< Number of pushes in the last run, both phases
+    static long long lastRelabels; ///< Number of relabel operations in the last run, both phases
+    static int lastGlobalRelabels; ///< Number of global relabelings in the last run
+    static int lastGaps; ///< Number of gaps found in the last run
+    static double lastPhaseOneTime; ///< Seconds spent on the maximum preflow in the last run
+    static double lastPhaseTwoTime; ///< Seconds spent on the flow recovery in the last run
+
+    /**
+     * @brief Executes the push-relabel algorithm on a residual network, starting from zero flow.
+     * @param network The residual network; it holds the maximum flow afterwards.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param selection The order in which active vertices are discharged.
+     * @return The maximum flow from source to sink.
+     */
+    static int AlgorithmCalculation(FlowNetwork &network, int source, int sink, Selection selection = HIGHEST_LABEL);
+
+    /**
+     * @brief Executes the push-relabel algorithm on a graph represented as an adjacency list.
+     * @param graph The adjacency list representing the graph.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param numVertices The number of vertices in the graph.
+     * @param selection The order in which active vertices are discharged.
+     * @return The maximum flow from source to sink.
+     */
+    static int AlgorithmCalculationFromList(slistEl **graph, int source, int sink, int numVertices,
+                                            Selection selection = HIGHEST_LABEL);
+
+    /**
+     * @brief Measures and prints the time taken by the push-relabel algorithm on a graph represented as an adjacency list.
+     * @param graph The adjacency list representing the graph.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param numVertices The number of vertices in the graph.
+     * @param selection The order in which active vertices are discharged.
+     */
+    static void TimeCounterList(slistEl **graph, int source, int sink, int numVertices, Selection selection);
+
+    /**
+     * @brief Runs Dinic's algorithm and both push-relabel variants on the same residual network and compares them.
+     * @param graph The adjacency list representing the graph.
+     * @param source The source vertex.
+     * @param sink The sink vertex.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void CompareEngines(slistEl **graph, int source, int sink, int numVertices);
+
+    /**
+     * @brief Returns a printable name of a selection rule.
+     * @param selection The selection rule.
+     * @return The name of the rule.
+     */
+    static const char* SelectionName(Selection selection);
+};
+
+#endif // PUSHRELABEL_H
@@ -0,0 +1,197 @@
+/**
+ * @file SSSPBatchRunner.cpp
+ * @brief This file contains the implementation of the SSSPBatchRunner class.
+ */
+
+#include "SSSPBatchRunner.h"
+#include "Dijkstra.h"
+#include "BellmanFord.h"
+#include "CsrGraph.h"
+#include <iostream>
+#include <climits>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Resolves a requested thread count, mapping 0 to the hardware concurrency.
+ * @param requested The requested number of threads.
+ * @return The number of threads to start, at least 1.
+ */
+int SSSPBatchRunner::ResolveThreads(int requested) {
+    if (requested > 0) {
+        return requested;
+    }
+    int hardware = (int) thread::hardware_concurrency();
+    return hardware > 0 ? hardware : 1;
+}
+
+/**
+ * @brief Hands the sources out to a pool of workers that each own one set of buffers.
+ *
+ * Workers pull the next source index from a shared counter, so uneven per-source costs balance out on their own.
+ *
+ * @param numVertices The number of vertices in the graph.
+ * @param sources The source vertices, or nullptr to run from all vertices.
+ * @param numSources The number of entries in sources (ignored when sources is nullptr).
+ * @param numThreads The number of worker threads; 0 uses the hardware concurrency.
+ * @param solve The single-source algorithm.
+ * @param sink The callback receiving each result.
+ */
+void SSSPBatchRunner::dispatch(int numVertices, const int *sources, int numSources, int numThreads, const Solver &solve,
+                               const ResultSink &sink) {
+    int total = sources == nullptr ? numVertices : numSources;
+    if (total <= 0 || numVertices <= 0) {
+        return;
+    }
+    int threads = ResolveThreads(numThreads);
+    if (threads > total) {
+        threads = total;
+    }
+
+    atomic<int> nextSource(0);
+    mutex sinkMutex;
+
+    auto worker = [&]() {
+        int* dist = new int[numVertices];
+        int* prev = new int[numVertices];
+        bool* visited = new bool[numVertices];
+        PriorityQueue pq(numVertices, dist);
+
+        while (true) {
+            int idx = nextSource.fetch_add(1);
+            if (idx >= total) break;
+            int source = sources == nullptr ? idx : sources[idx];
+
+            bool valid = solve(source, dist, prev, visited, pq);
+
+            lock_guard<mutex> lock(sinkMutex);
+            sink(source, dist, prev, numVertices, valid);
+        }
+
+        delete[] dist;
+        delete[] prev;
+        delete[] visited;
+    };
+
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (thread &t : pool) {
+        t.join();
+    }
+}
+
+/**
+ * @brief Runs the chosen algorithm from every given source.
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ * @param sources The source vertices, or nullptr to run from all vertices.
+ * @param numSources The number of entries in sources (ignored when sources is nullptr).
+ * @param algorithm The single-source algorithm to run.
+ * @param numThreads The number of worker threads; 0 uses the hardware concurrency.
+ * @param sink The callback receiving each result.
+ */
+void SSSPBatchRunner::Run(slistEl **adjList, int numVertices, const int *sources, int numSources, Algorithm algorithm,
+                          int numThreads, const ResultSink &sink) {
+    dispatch(numVertices, sources, numSources, numThreads,
+             [&](int source, int* dist, int* prev, bool* visited, PriorityQueue& pq) {
+                 if (algorithm == BELLMAN_FORD) {
+                     return BellmanFord::AlgorithmCalculationFromList(adjList, numVertices, source, dist, prev);
+                 }
+                 Dijkstra::AlgorithmCalculationFromList(adjList, numVertices, source, dist, prev, visited, pq);
+                 return true;
+             }, sink);
+}
+
+/**
+ * @brief Runs Dijkstra's algorithm on a CSR graph from every given source.
+ * @param graph The graph in CSR form; all weights must be non-negative.
+ * @param sources The source vertices, or nullptr to run from all vertices.
+ * @param numSources The number of entries in sources (ignored when sources is nullptr).
+ * @param numThreads The number of worker threads; 0 uses the hardware concurrency.
+ * @param sink The callback receiving each result.
+ */
+void SSSPBatchRunner::Run(const CsrGraph &graph, const int *sources, int numSources, int numThreads,
+                          const ResultSink &sink) {
+    dispatch(graph.numVertices, sources, numSources, numThreads,
+             [&](int source, int* dist, int* prev, bool* visited, PriorityQueue& pq) {
+                 Dijkstra::AlgorithmCalculationFromCsr(graph, source, dist, prev, visited, pq);
+                 return true;
+             }, sink);
+}
+
+/**
+ * @brief Measures and prints the time taken by a batch run on a graph represented as an adjacency list.
+ *
+ * The sink only aggregates the distances, so the run exercises the streaming path without storing any result.
+ *
+ * @param adjList The adjacency list representing the graph.
+ * @param numVertices The number of vertices in the graph.
+ */
+void SSSPBatchRunner::TimeCounterList(slistEl **adjList, int numVertices) {
+    if (numVertices <= 0) {
+        cout << "The graph is empty" << endl;
+        return;
+    }
+    cout << "Choose the algorithm (1 - Dijkstra, 2 - Bellman-Ford): ";
+    int algorithm;
+    cin >> algorithm;
+    cout << "Give number of sources (0 - all vertices): ";
+    int numSources;
+    cin >> numSources;
+    cout << "Give number of threads (0 - all cores): ";
+    int numThreads;
+    cin >> numThreads;
+    cout << endl;
+
+    int* sources = nullptr;
+    if (numSources > 0) {
+        sources = new int[numSources];
+        for (int i = 0; i < numSources; i++) {
+            sources[i] = rand() % numVertices;
+        }
+    } else {
+        numSources = numVertices;
+    }
+
+    long long reachablePairs = 0;
+    long long distanceSum = 0;
+    int negativeCycles = 0;
+    ResultSink sink = [&](int, const int* dist, const int*, int n, bool valid) {
+        if (!valid) {
+            negativeCycles++;
+            return;
+        }
+        for (int v = 0; v < n; v++) {
+            if (dist[v] != INT_MAX) {
+                reachablePairs++;
+                distanceSum += dist[v];
+            }
+        }
+    };
+
+    auto start = chrono::high_resolution_clock::now();
+    Run(adjList, numVertices, sources, numSources, algorithm == 2 ? BELLMAN_FORD : DIJKSTRA, numThreads, sink);
+    auto end = chrono::high_resolution_clock::now();
+    chrono::duration<double> elapsed = end - start;
+
+    cout << "Threads: " << min(ResolveThreads(numThreads), numSources) << endl;
+    cout << "Sources: " << numSources << endl;
+    cout << "Reachable pairs: " << reachablePairs << endl;
+    cout << "Sum of distances: " << distanceSum << endl;
+    if (negativeCycles > 0) {
+        cout << "Sources reaching a negative-weight cycle: " << negativeCycles << endl;
+    }
+    cout << "Elapsed time: " << elapsed.count() * 1000 << " ms" << endl;
+    cout << "Average time per source: " << elapsed.count() / numSources * 1000 << " ms" << endl;
+
+    delete[] sources;
+}
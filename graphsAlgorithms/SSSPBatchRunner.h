@@ -0,0 +1,98 @@
+/**
+ * @file SSSPBatchRunner.h
+ * @brief This file contains the declaration of the SSSPBatchRunner class.
+ */
+
+#ifndef SSSPBATCHRUNNER_H
+#define SSSPBATCHRUNNER_H
+
+#include <functional>
+#include "../GraphsGenerating.h"
+
+class CsrGraph;
+class PriorityQueue;
+
+/**
+ * @class SSSPBatchRunner
+ * @brief Class running single-source shortest path computations from many sources on a pool of worker threads.
+ *
+ * Every worker owns one set of dist/prev/heap buffers and reuses it for all the sources it takes, and each result
+ * is handed to a sink as soon as it is ready. Memory therefore stays proportional to threads * vertices instead of
+ * holding a full distance matrix.
+ */
+class SSSPBatchRunner {
+public:
+    /**
+     * @enum Algorithm
+     * @brief The single-source algorithm run for every source.
+     */
+    enum Algorithm {
+        DIJKSTRA = 1, ///< Dijkstra's algorithm
+        BELLMAN_FORD = 2 ///< The Bellman-Ford algorithm
+    };
+
+    /**
+     * @brief Receives the result of one source: (source, dist, prev, numVertices, valid).
+     *
+     * The arrays belong to the worker and are only valid during the call. The flag is false when Bellman-Ford found
+     * a negative-weight cycle. Calls are serialized, so the sink does not need to be thread-safe.
+     */
+    typedef std::function<void(int, const int*, const int*, int, bool)> ResultSink;
+
+    /**
+     * @brief Runs the chosen algorithm from every given source.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     * @param sources The source vertices, or nullptr to run from all vertices.
+     * @param numSources The number of entries in sources (ignored when sources is nullptr).
+     * @param algorithm The single-source algorithm to run.
+     * @param numThreads The number of worker threads; 0 uses the hardware concurrency.
+     * @param sink The callback receiving each result.
+     */
+    static void Run(slistEl **adjList, int numVertices, const int *sources, int numSources, Algorithm algorithm,
+                    int numThreads, const ResultSink &sink);
+
+    /**
+     * @brief Runs Dijkstra's algorithm on a CSR graph from every given source.
+     * @param graph The graph in CSR form; all weights must be non-negative.
+     * @param sources The source vertices, or nullptr to run from all vertices.
+     * @param numSources The number of entries in sources (ignored when sources is nullptr).
+     * @param numThreads The number of worker threads; 0 uses the hardware concurrency.
+     * @param sink The callback receiving each result.
+     */
+    static void Run(const CsrGraph &graph, const int *sources, int numSources, int numThreads, const ResultSink &sink);
+
+    /**
+     * @brief Measures and prints the time taken by a batch run on a graph represented as an adjacency list.
+     * @param adjList The adjacency list representing the graph.
+     * @param numVertices The number of vertices in the graph.
+     */
+    static void TimeCounterList(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Resolves a requested thread count, mapping 0 to the hardware concurrency.
+     * @param requested The requested number of threads.
+     * @return The number of threads to start, at least 1.
+     */
+    static int ResolveThreads(int requested);
+
+private:
+    /**
+     * @brief Solves one source into worker-owned buffers: (source, dist, prev, visited, pq) -> valid.
+     */
+    typedef std::function<bool(int, int*, int*, bool*, PriorityQueue&)> Solver;
+
+    /**
+     * @brief Hands the sources out to a pool of workers that each own one set of buffers.
+     * @param numVertices The number of vertices in the graph.
+     * @param sources The source vertices, or nullptr to run from all vertices.
+     * @param numSources The number of entries in sources (ignored when sources is nullptr).
+     * @param numThreads The number of worker threads; 0 uses the hardware concurrency.
+     * @param solve The single-source algorithm.
+     * @param sink The callback receiving each result.
+     */
+    static void dispatch(int numVertices, const int *sources, int numSources, int numThreads, const Solver &solve,
+                         const ResultSink &sink);
+};
+
+#endif // SSSPBATCHRUNNER_H
@@ -0,0 +1,597 @@
+/**
+ * @file SimdKernels.cpp
+ * @brief This file contains the implementation of the SimdKernels class.
+ */
+
+#include "SimdKernels.h"
+#include <climits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_KERNELS_X86 1
+#include <immintrin.h>
+#else
+#define SIMD_KERNELS_X86 0
+#endif
+
+/**
+ * @brief Detects the widest supported instruction set once.
+ * @return The detected level.
+ */
+static SimdKernels::Level detectLevel() {
+#if SIMD_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdKernels::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdKernels::AVX2;
+    }
+#endif
+    return SimdKernels::SCALAR;
+}
+
+static SimdKernels::Level detectedLevel = detectLevel();
+static SimdKernels::Level activeLevel = detectedLevel;
+
+/**
+ * @brief Checks for AVX-512 conflict detection, needed by the scatter-based relaxation kernel.
+ * @return True if the CPU supports AVX512CD.
+ */
+static bool detectConflictDetection() {
+#if SIMD_KERNELS_X86
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512cd");
+#else
+    return false;
+#endif
+}
+
+static bool hasConflictDetection = detectConflictDetection();
+
+/**
+ * @brief Scalar fallback of NonZeroPositions.
+ */
+static int nonZeroScalar(const int *row, int length, int *positions) {
+    int count = 0;
+    for (int e = 0; e < length; e++) {
+        if (row[e] != 0) {
+            positions[count++] = e;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Scalar fallback of PositivePositions.
+ */
+static int positiveScalar(const int *row, int length, int *positions) {
+    int count = 0;
+    for (int e = 0; e < length; e++) {
+        if (row[e] > 0) {
+            positions[count++] = e;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Scalar fallback of RelaxEdges.
+ */
+static bool relaxScalar(const int *src, const int *dst, const int *weight, int count, int *dist, int *prev) {
+    bool updated = false;
+    for (int e = 0; e < count; e++) {
+        int du = dist[src[e]];
+        if (du != INT_MAX && du + weight[e] < dist[dst[e]]) {
+            dist[dst[e]] = du + weight[e];
+            prev[dst[e]] = src[e];
+            updated = true;
+        }
+    }
+    return updated;
+}
+
+/**
+ * @brief Scalar fallback of MinPlusTile.
+ */
+static void minPlusScalar(int *c, int *cNext, const int *a, const int *aNext, const int *b, int size, int infinity) {
+    for (int k = 0; k < size; k++) {
+        for (int i = 0; i < size; i++) {
+            int aik = a[i * size + k];
+            if (aik >= infinity) continue;
+            int next = aNext[i * size + k];
+            for (int j = 0; j < size; j++) {
+                int candidate = aik + b[k * size + j];
+                if (candidate < c[i * size + j]) {
+                    c[i * size + j] = candidate;
+                    cNext[i * size + j] = next;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Scalar fallback of ArgMin.
+ */
+static int argMinScalar(const int *values, int count) {
+    int best = INT_MAX, bestIndex = -1;
+    for (int i = 0; i < count; i++) {
+        if (values[i] < best) {
+            best = values[i];
+            bestIndex = i;
+        }
+    }
+    return bestIndex;
+}
+
+/**
+ * @brief Scalar fallback of RelaxRow.
+ */
+static void relaxRowScalar(int *key, int *parent, const int *row, const int *floor, int count, int source) {
+    for (int v = 0; v < count; v++) {
+        int candidate = row[v] > floor[v] ? row[v] : floor[v];
+        if (candidate < key[v]) {
+            key[v] = candidate;
+            parent[v] = source;
+        }
+    }
+}
+
+#if SIMD_KERNELS_X86
+/**
+ * @brief AVX2 row scan: 16 cells are tested per iteration and all-zero blocks are skipped with one test.
+ */
+template <bool positiveOnly>
+__attribute__((target("avx2")))
+static int scanAvx2(const int *row, int length, int *positions) {
+    const __m256i zero = _mm256_setzero_si256();
+    int count = 0;
+    int e = 0;
+    for (; e + 16 <= length; e += 16) {
+        __m256i a = _mm256_loadu_si256((const __m256i *) (row + e));
+        __m256i b = _mm256_loadu_si256((const __m256i *) (row + e + 8));
+        if (_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_or_si256(a, b))) {
+            continue;
+        }
+        unsigned maskA, maskB;
+        if (positiveOnly) {
+            maskA = (unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(a, zero)));
+            maskB = (unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(b, zero)));
+        } else {
+            maskA = ~(unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, zero))) & 0xFFu;
+            maskB = ~(unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(b, zero))) & 0xFFu;
+        }
+        unsigned mask = maskA | (maskB << 8);
+        while (mask) {
+            positions[count++] = e + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+    for (; e < length; e++) {
+        if (positiveOnly ? row[e] > 0 : row[e] != 0) {
+            positions[count++] = e;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief AVX-512 row scan: the matching lane indices are written directly with a compress store.
+ */
+template <bool positiveOnly>
+__attribute__((target("avx512f")))
+static int scanAvx512(const int *row, int length, int *positions) {
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i step = _mm512_set1_epi32(16);
+    __m512i index = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    int count = 0;
+    int e = 0;
+    for (; e + 16 <= length; e += 16) {
+        __m512i v = _mm512_loadu_si512((const void *) (row + e));
+        __mmask16 mask = positiveOnly ? _mm512_cmpgt_epi32_mask(v, zero) : _mm512_test_epi32_mask(v, v);
+        if (mask) {
+            _mm512_mask_compressstoreu_epi32(positions + count, mask, index);
+            count += __builtin_popcount((unsigned) mask);
+        }
+        index = _mm512_add_epi32(index, step);
+    }
+    for (; e < length; e++) {
+        if (positiveOnly ? row[e] > 0 : row[e] != 0) {
+            positions[count++] = e;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief AVX2 relaxation: candidates are computed with gathers for 8 edges at a time. AVX2 has no scatter, so the
+ * improving lanes are written back one by one, re-checking the distance; this also resolves lanes that share a
+ * destination.
+ */
+__attribute__((target("avx2")))
+static bool relaxAvx2(const int *src, const int *dst, const int *weight, int count, int *dist, int *prev) {
+    const __m256i infinity = _mm256_set1_epi32(INT_MAX);
+    bool updated = false;
+    int e = 0;
+    for (; e + 8 <= count; e += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i *) (src + e));
+        __m256i d = _mm256_loadu_si256((const __m256i *) (dst + e));
+        __m256i w = _mm256_loadu_si256((const __m256i *) (weight + e));
+        __m256i du = _mm256_i32gather_epi32(dist, s, 4);
+        __m256i dv = _mm256_i32gather_epi32(dist, d, 4);
+        __m256i candidate = _mm256_add_epi32(du, w);
+        __m256i better = _mm256_andnot_si256(_mm256_cmpeq_epi32(du, infinity), _mm256_cmpgt_epi32(dv, candidate));
+        unsigned mask = (unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(better));
+        while (mask) {
+            int lane = e + __builtin_ctz(mask);
+            mask &= mask - 1;
+            int value = dist[src[lane]] + weight[lane];
+            if (value < dist[dst[lane]]) {
+                dist[dst[lane]] = value;
+                prev[dst[lane]] = src[lane];
+                updated = true;
+            }
+        }
+    }
+    return relaxScalar(src + e, dst + e, weight + e, count - e, dist, prev) || updated;
+}
+
+/**
+ * @brief AVX-512 relaxation with gathers and scatters for 16 edges at a time.
+ *
+ * Lanes sharing a destination are found with a conflict-detection instruction. Every lane folds in the
+ * candidates of the earlier lanes with the same destination, so the last of them holds the minimum. Scatters
+ * write overlapping lanes in lane order, so that minimum is the value that lands in memory.
+ */
+__attribute__((target("avx512f,avx512cd")))
+static bool relaxAvx512(const int *src, const int *dst, const int *weight, int count, int *dist, int *prev) {
+    const __m512i infinity = _mm512_set1_epi32(INT_MAX);
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i highestBit = _mm512_set1_epi32(31);
+    const __m512i zero = _mm512_setzero_si512();
+    bool updated = false;
+    int e = 0;
+    for (; e + 16 <= count; e += 16) {
+        __m512i s = _mm512_loadu_si512((const void *) (src + e));
+        __m512i d = _mm512_loadu_si512((const void *) (dst + e));
+        __m512i w = _mm512_loadu_si512((const void *) (weight + e));
+        __m512i du = _mm512_mask_i32gather_epi32(zero, 0xFFFF, s, dist, 4);
+        __m512i dv = _mm512_mask_i32gather_epi32(zero, 0xFFFF, d, dist, 4);
+        __m512i candidate = _mm512_add_epi32(du, w);
+        __mmask16 active = _mm512_mask_cmplt_epi32_mask(_mm512_cmpneq_epi32_mask(du, infinity), candidate, dv);
+        if (!active) continue;
+
+        // Bits of the earlier active lanes with the same destination
+        __m512i conflicts = _mm512_maskz_conflict_epi32(active, d);
+        conflicts = _mm512_and_si512(conflicts, _mm512_set1_epi32(active));
+        __m512i from = s;
+        __mmask16 pending = _mm512_mask_test_epi32_mask(active, conflicts, conflicts);
+        while (pending) {
+            __m512i lane = _mm512_sub_epi32(highestBit, _mm512_lzcnt_epi32(conflicts));
+            __m512i other = _mm512_maskz_permutexvar_epi32(pending, lane, candidate);
+            __m512i otherFrom = _mm512_maskz_permutexvar_epi32(pending, lane, from);
+            __mmask16 smaller = _mm512_mask_cmplt_epi32_mask(pending, other, candidate);
+            candidate = _mm512_mask_mov_epi32(candidate, smaller, other);
+            from = _mm512_mask_mov_epi32(from, smaller, otherFrom);
+            conflicts = _mm512_mask_andnot_epi32(conflicts, pending, _mm512_maskz_sllv_epi32(pending, one, lane), conflicts);
+            pending = _mm512_mask_test_epi32_mask(pending, conflicts, conflicts);
+        }
+        _mm512_mask_i32scatter_epi32(dist, active, d, candidate, 4);
+        _mm512_mask_i32scatter_epi32(prev, active, d, from, 4);
+        updated = true;
+    }
+    return relaxScalar(src + e, dst + e, weight + e, count - e, dist, prev) || updated;
+}
+
+/**
+ * @brief AVX2 min-plus tile update, 8 columns per instruction with blends for the distances and next hops.
+ */
+__attribute__((target("avx2")))
+static void minPlusAvx2(int *c, int *cNext, const int *a, const int *aNext, const int *b, int size, int infinity) {
+    for (int k = 0; k < size; k++) {
+        const int *bRow = b + k * size;
+        for (int i = 0; i < size; i++) {
+            int aik = a[i * size + k];
+            if (aik >= infinity) continue;
+            __m256i base = _mm256_set1_epi32(aik);
+            __m256i next = _mm256_set1_epi32(aNext[i * size + k]);
+            int *cRow = c + i * size;
+            int *nRow = cNext + i * size;
+            for (int j = 0; j < size; j += 8) {
+                __m256i candidate = _mm256_add_epi32(base, _mm256_loadu_si256((const __m256i *) (bRow + j)));
+                __m256i current = _mm256_loadu_si256((const __m256i *) (cRow + j));
+                __m256i better = _mm256_cmpgt_epi32(current, candidate);
+                _mm256_storeu_si256((__m256i *) (cRow + j), _mm256_min_epi32(current, candidate));
+                __m256i hops = _mm256_loadu_si256((const __m256i *) (nRow + j));
+                _mm256_storeu_si256((__m256i *) (nRow + j), _mm256_blendv_epi8(hops, next, better));
+            }
+        }
+    }
+}
+
+/**
+ * @brief AVX-512 min-plus tile update, 16 columns per instruction with masked moves for the next hops.
+ */
+__attribute__((target("avx512f")))
+static void minPlusAvx512(int *c, int *cNext, const int *a, const int *aNext, const int *b, int size, int infinity) {
+    for (int k = 0; k < size; k++) {
+        const int *bRow = b + k * size;
+        for (int i = 0; i < size; i++) {
+            int aik = a[i * size + k];
+            if (aik >= infinity) continue;
+            __m512i base = _mm512_set1_epi32(aik);
+            __m512i next = _mm512_set1_epi32(aNext[i * size + k]);
+            int *cRow = c + i * size;
+            int *nRow = cNext + i * size;
+            for (int j = 0; j < size; j += 16) {
+                __m512i candidate = _mm512_add_epi32(base, _mm512_loadu_si512((const void *) (bRow + j)));
+                __m512i current = _mm512_loadu_si512((const void *) (cRow + j));
+                __mmask16 better = _mm512_cmplt_epi32_mask(candidate, current);
+                if (!better) continue;
+                _mm512_mask_storeu_epi32(cRow + j, better, candidate);
+                _mm512_mask_storeu_epi32(nRow + j, better, next);
+            }
+        }
+    }
+}
+/**
+ * @brief AVX2 argmin: every lane keeps its running minimum and the first position holding it.
+ */
+__attribute__((target("avx2")))
+static int argMinAvx2(const int *values, int count) {
+    __m256i best = _mm256_set1_epi32(INT_MAX);
+    __m256i bestIndex = _mm256_set1_epi32(-1);
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i step = _mm256_set1_epi32(8);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) (values + i));
+        __m256i smaller = _mm256_cmpgt_epi32(best, v);
+        best = _mm256_min_epi32(best, v);
+        bestIndex = _mm256_blendv_epi8(bestIndex, index, smaller);
+        index = _mm256_add_epi32(index, step);
+    }
+    int lanes[8], positions[8];
+    _mm256_storeu_si256((__m256i *) lanes, best);
+    _mm256_storeu_si256((__m256i *) positions, bestIndex);
+    int minimum = INT_MAX, result = -1;
+    for (int l = 0; l < 8; l++) {
+        if (lanes[l] < minimum || (lanes[l] == minimum && result != -1 && positions[l] < result)) {
+            minimum = lanes[l];
+            result = positions[l];
+        }
+    }
+    for (; i < count; i++) {
+        if (values[i] < minimum) {
+            minimum = values[i];
+            result = i;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief AVX2 Prim key update; the floor is applied with one max, so settled vertices never pass the compare.
+ */
+__attribute__((target("avx2")))
+static void relaxRowAvx2(int *key, int *parent, const int *row, const int *floor, int count, int source) {
+    const __m256i src = _mm256_set1_epi32(source);
+    int v = 0;
+    for (; v + 8 <= count; v += 8) {
+        __m256i candidate = _mm256_max_epi32(_mm256_loadu_si256((const __m256i *) (row + v)),
+                                             _mm256_loadu_si256((const __m256i *) (floor + v)));
+        __m256i current = _mm256_loadu_si256((const __m256i *) (key + v));
+        __m256i better = _mm256_cmpgt_epi32(current, candidate);
+        if (_mm256_testz_si256(better, better)) continue;
+        _mm256_storeu_si256((__m256i *) (key + v), _mm256_min_epi32(current, candidate));
+        __m256i parents = _mm256_loadu_si256((const __m256i *) (parent + v));
+        _mm256_storeu_si256((__m256i *) (parent + v), _mm256_blendv_epi8(parents, src, better));
+    }
+    relaxRowScalar(key + v, parent + v, row + v, floor + v, count - v, source);
+}
+
+/**
+ * @brief AVX-512 argmin: every lane keeps its running minimum and the first position holding it.
+ */
+__attribute__((target("avx512f")))
+static int argMinAvx512(const int *values, int count) {
+    __m512i best = _mm512_set1_epi32(INT_MAX);
+    __m512i bestIndex = _mm512_set1_epi32(-1);
+    __m512i index = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m512i step = _mm512_set1_epi32(16);
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512i v = _mm512_loadu_si512((const void *) (values + i));
+        __mmask16 smaller = _mm512_cmplt_epi32_mask(v, best);
+        best = _mm512_maskz_min_epi32(0xFFFF, best, v);
+        bestIndex = _mm512_mask_mov_epi32(bestIndex, smaller, index);
+        index = _mm512_add_epi32(index, step);
+    }
+    int lanes[16], positions[16];
+    _mm512_storeu_si512((void *) lanes, best);
+    _mm512_storeu_si512((void *) positions, bestIndex);
+    int minimum = INT_MAX, result = -1;
+    for (int l = 0; l < 16; l++) {
+        if (lanes[l] < minimum || (lanes[l] == minimum && result != -1 && positions[l] < result)) {
+            minimum = lanes[l];
+            result = positions[l];
+        }
+    }
+    for (; i < count; i++) {
+        if (values[i] < minimum) {
+            minimum = values[i];
+            result = i;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief AVX-512 Prim key update with masked stores of the improved keys and parents.
+ */
+__attribute__((target("avx512f")))
+static void relaxRowAvx512(int *key, int *parent, const int *row, const int *floor, int count, int source) {
+    const __m512i src = _mm512_set1_epi32(source);
+    int v = 0;
+    for (; v + 16 <= count; v += 16) {
+        __m512i candidate = _mm512_maskz_max_epi32(0xFFFF, _mm512_loadu_si512((const void *) (row + v)),
+                                                   _mm512_loadu_si512((const void *) (floor + v)));
+        __mmask16 better = _mm512_cmplt_epi32_mask(candidate, _mm512_loadu_si512((const void *) (key + v)));
+        if (!better) continue;
+        _mm512_mask_storeu_epi32(key + v, better, candidate);
+        _mm512_mask_storeu_epi32(parent + v, better, src);
+    }
+    relaxRowScalar(key + v, parent + v, row + v, floor + v, count - v, source);
+}
+#endif
+
+/**
+ * @brief Returns the instruction set the kernels currently use.
+ * @return The active level.
+ */
+SimdKernels::Level SimdKernels::ActiveLevel() {
+    return activeLevel;
+}
+
+/**
+ * @brief Returns the widest instruction set supported by the CPU and the compiler.
+ * @return The detected level.
+ */
+SimdKernels::Level SimdKernels::DetectedLevel() {
+    return detectedLevel;
+}
+
+/**
+ * @brief Restricts the kernels to an instruction set, e.g. to compare against the scalar fallback.
+ * @param level The requested level; it is capped at the detected level.
+ */
+void SimdKernels::ForceLevel(Level level) {
+    activeLevel = level > detectedLevel ? detectedLevel : level;
+}
+
+/**
+ * @brief Returns a printable name of a level.
+ * @param level The level.
+ * @return The name of the level.
+ */
+const char* SimdKernels::LevelName(Level level) {
+    switch (level) {
+        case AVX512:
+            return "AVX-512";
+        case AVX2:
+            return "AVX2";
+        default:
+            return "scalar";
+    }
+}
+
+/**
+ * @brief Writes the positions of all non-zero cells of a row, in increasing order.
+ * @param row The row to scan.
+ * @param length The number of cells in the row.
+ * @param positions Output array with room for length entries.
+ * @return The number of positions written.
+ */
+int SimdKernels::NonZeroPositions(const int *row, int length, int *positions) {
+#if SIMD_KERNELS_X86
+    if (activeLevel == AVX512) return scanAvx512<false>(row, length, positions);
+    if (activeLevel == AVX2) return scanAvx2<false>(row, length, positions);
+#endif
+    return nonZeroScalar(row, length, positions);
+}
+
+/**
+ * @brief Writes the positions of all positive cells of a row, in increasing order.
+ * @param row The row to scan.
+ * @param length The number of cells in the row.
+ * @param positions Output array with room for length entries.
+ * @return The number of positions written.
+ */
+int SimdKernels::PositivePositions(const int *row, int length, int *positions) {
+#if SIMD_KERNELS_X86
+    if (activeLevel == AVX512) return scanAvx512<true>(row, length, positions);
+    if (activeLevel == AVX2) return scanAvx2<true>(row, length, positions);
+#endif
+    return positiveScalar(row, length, positions);
+}
+
+/**
+ * @brief Relaxes every edge of a structure-of-arrays edge list once.
+ *
+ * The vector kernels read the source distances of a whole vector before writing any of its results, so an
+ * improvement found inside a vector is only propagated by later vectors. That is still a valid Bellman-Ford
+ * pass: each relaxation uses a distance that was reachable when the pass started.
+ *
+ * @param src The source vertex of every edge.
+ * @param dst The destination vertex of every edge.
+ * @param weight The weight of every edge.
+ * @param count The number of edges.
+ * @param dist The distances, INT_MAX for unreached vertices; updated in place.
+ * @param prev The previous vertices; updated in place.
+ * @return True if any distance decreased.
+ */
+bool SimdKernels::RelaxEdges(const int *src, const int *dst, const int *weight, int count, int *dist, int *prev) {
+#if SIMD_KERNELS_X86
+    if (activeLevel == AVX512 && hasConflictDetection) return relaxAvx512(src, dst, weight, count, dist, prev);
+    if (activeLevel >= AVX2) return relaxAvx2(src, dst, weight, count, dist, prev);
+#endif
+    return relaxScalar(src, dst, weight, count, dist, prev);
+}
+
+/**
+ * @brief Floyd-Warshall min-plus update of one tile: c[i][j] = min(c[i][j], a[i][k] + b[k][j]) for every k.
+ *
+ * The loops run k, i, j, so the innermost loop streams one row of b against one row of c. When a or b alias c
+ * (the diagonal and the row/column tiles of a blocked Floyd-Warshall phase) the entries read for step k are the
+ * ones in row or column k, which step k itself cannot change without a negative cycle.
+ *
+ * @param c The tile to update, size x size, row by row.
+ * @param cNext The next-hop tile matching c; set to aNext[i][k] wherever c improves.
+ * @param a The tile holding the (i, k) distances; it may alias c.
+ * @param aNext The next-hop tile matching a; it may alias cNext.
+ * @param b The tile holding the (k, j) distances; it may alias c.
+ * @param size The side of the tiles, a multiple of 16.
+ * @param infinity Entries at or above this value are unreachable and never extended.
+ */
+void SimdKernels::MinPlusTile(int *c, int *cNext, const int *a, const int *aNext, const int *b, int size, int infinity) {
+#if SIMD_KERNELS_X86
+    if (activeLevel == AVX512) return minPlusAvx512(c, cNext, a, aNext, b, size, infinity);
+    if (activeLevel == AVX2) return minPlusAvx2(c, cNext, a, aNext, b, size, infinity);
+#endif
+    minPlusScalar(c, cNext, a, aNext, b, size, infinity);
+}
+
+/**
+ * @brief Finds the position of the smallest value; ties go to the lowest position.
+ * @param values The values to scan.
+ * @param count The number of values.
+ * @return The position of the minimum, or -1 if count is 0 or every value is INT_MAX.
+ */
+int SimdKernels::ArgMin(const int *values, int count) {
+#if SIMD_KERNELS_X86
+    if (activeLevel == AVX512) return argMinAvx512(values, count);
+    if (activeLevel == AVX2) return argMinAvx2(values, count);
+#endif
+    return argMinScalar(values, count);
+}
+
+/**
+ * @brief Prim key update for one matrix row: key[v] = max(row[v], floor[v]) wherever that is smaller.
+ *
+ * Folding the in-tree flags into a floor array turns the per-vertex branch of the scalar loop into one max, so
+ * the loop body is branch-free and vectorizes to a max, a compare and two masked moves.
+ *
+ * @param key The keys; updated in place.
+ * @param parent The parents; set to source wherever the key decreases.
+ * @param row The edge weights from source, INT_MAX where there is no edge.
+ * @param floor 0 for vertices outside the tree and INT_MAX for vertices in it, which blocks their update.
+ * @param count The number of entries.
+ * @param source The vertex the row belongs to.
+ */
+void SimdKernels::RelaxRow(int *key, int *parent, const int *row, const int *floor, int count, int source) {
+#if SIMD_KERNELS_X86
+    if (activeLevel == AVX512) return relaxRowAvx512(key, parent, row, floor, count, source);
+    if (activeLevel == AVX2) return relaxRowAvx2(key, parent, row, floor, count, source);
+#endif
+    relaxRowScalar(key, parent, row, floor, count, source);
+}
@@ -0,0 +1,116 @@
+/**
+ * @file SimdKernels.h
+ * @brief This file contains the declaration of the SimdKernels class.
+ */
+
+#ifndef SIMDKERNELS_H
+#define SIMDKERNELS_H
+
+/**
+ * @class SimdKernels
+ * @brief Class collecting the vectorized inner loops shared by the graph algorithms.
+ *
+ * Every kernel has a scalar version and, on x86 compilers that support target attributes, AVX2 and AVX-512
+ * versions. The widest instruction set the CPU supports is detected at runtime on first use, so the same binary
+ * runs everywhere.
+ */
+class SimdKernels {
+public:
+    /**
+     * @enum Level
+     * @brief Instruction set used by the kernels.
+     */
+    enum Level {
+        SCALAR = 0, ///< Plain C++ loops
+        AVX2 = 1, ///< 256-bit kernels, 8 ints per instruction
+        AVX512 = 2 ///< 512-bit kernels, 16 ints per instruction
+    };
+
+    /**
+     * @brief Returns the instruction set the kernels currently use.
+     * @return The active level.
+     */
+    static Level ActiveLevel();
+
+    /**
+     * @brief Returns the widest instruction set supported by the CPU and the compiler.
+     * @return The detected level.
+     */
+    static Level DetectedLevel();
+
+    /**
+     * @brief Restricts the kernels to an instruction set, e.g. to compare against the scalar fallback.
+     * @param level The requested level; it is capped at the detected level.
+     */
+    static void ForceLevel(Level level);
+
+    /**
+     * @brief Returns a printable name of a level.
+     * @param level The level.
+     * @return The name of the level.
+     */
+    static const char* LevelName(Level level);
+
+    /**
+     * @brief Writes the positions of all non-zero cells of a row, in increasing order.
+     * @param row The row to scan.
+     * @param length The number of cells in the row.
+     * @param positions Output array with room for length entries.
+     * @return The number of positions written.
+     */
+    static int NonZeroPositions(const int *row, int length, int *positions);
+
+    /**
+     * @brief Writes the positions of all positive cells of a row, in increasing order.
+     * @param row The row to scan.
+     * @param length The number of cells in the row.
+     * @param positions Output array with room for length entries.
+     * @return The number of positions written.
+     */
+    static int PositivePositions(const int *row, int length, int *positions);
+
+    /**
+     * @brief Relaxes every edge of a structure-of-arrays edge list once.
+     * @param src The source vertex of every edge.
+     * @param dst The destination vertex of every edge.
+     * @param weight The weight of every edge.
+     * @param count The number of edges.
+     * @param dist The distances, INT_MAX for unreached vertices; updated in place.
+     * @param prev The previous vertices; updated in place.
+     * @return True if any distance decreased.
+     */
+    static bool RelaxEdges(const int *src, const int *dst, const int *weight, int count, int *dist, int *prev);
+
+    /**
+     * @brief Floyd-Warshall min-plus update of one tile: c[i][j] = min(c[i][j], a[i][k] + b[k][j]) for every k.
+     * @param c The tile to update, size x size, row by row.
+     * @param cNext The next-hop tile matching c; set to aNext[i][k] wherever c improves.
+     * @param a The tile holding the (i, k) distances; it may alias c.
+     * @param aNext The next-hop tile matching a; it may alias cNext.
+     * @param b The tile holding the (k, j) distances; it may alias c.
+     * @param size The side of the tiles, a multiple of 16.
+     * @param infinity Entries at or above this value are unreachable and never extended.
+     */
+    static void MinPlusTile(int *c, int *cNext, const int *a, const int *aNext, const int *b, int size, int infinity);
+
+    /**
+     * @brief Finds the position of the smallest value; ties go to the lowest position.
+     * @param values The values to scan.
+     * @param count The number of values.
+     * @return The position of the minimum, or -1 if count is 0 or every value is INT_MAX.
+     */
+    static int ArgMin(const int *values, int count);
+
+    /**
+     * @brief Prim key update for one matrix row: key[v] = max(row[v], floor[v]) wherever that is smaller.
+     * @param key The keys; updated in place.
+     * @param parent The parents; set to source wherever the key decreases.
+     * @param row The edge weights from source, INT_MAX where there is no edge.
+     * @param floor 0 for vertices outside the tree and INT_MAX for vertices in it, which blocks their update.
+     * @param count The number of entries.
+     * @param source The vertex the row belongs to.
+     */
+    static void RelaxRow(int *key, int *parent, const int *row, const int *floor, int count, int source);
+};
+
+#endif // SIMDKERNELS_H
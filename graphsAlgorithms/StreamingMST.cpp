@@ -0,0 +1,161 @@
+/**
+ * @file StreamingMST.cpp
+ * @brief This file contains the implementation of the StreamingMST class.
+ */
+
+#include "StreamingMST.h"
+#include "ConcurrentUnionFind.h"
+#include "EdgeSort.h"
+#include <iostream>
+#include <cstdio>
+#include <chrono>
+#include <string>
+#include <filesystem>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define STREAMING_MST_RUSAGE 1
+#include <sys/resource.h>
+#else
+#define STREAMING_MST_RUSAGE 0
+#endif
+
+using namespace std;
+
+Kruskal::Edge* StreamingMST::mst = nullptr;
+int StreamingMST::mstSize = 0;
+long long StreamingMST::lastEdgesRead = 0;
+int StreamingMST::lastBatches = 0;
+size_t StreamingMST::lastPeakBytes = 0;
+
+/**
+ * @brief Computes the minimum spanning forest of all edges left in a reader.
+ *
+ * The forest is kept at the front of one work array and every batch is read right behind it, so a Kruskal run
+ * sorts the forest and the batch together and compacts the accepted edges back to the front. The union-find is
+ * reset for every run. Per edge this costs O(1 + V / B) amortized on top of the sort.
+ *
+ * @param reader The open edge file.
+ * @param bufferEdges The number of edges buffered between Kruskal runs; 0 uses one per vertex.
+ * @return The total weight of the forest.
+ */
+long long StreamingMST::AlgorithmCalculationFromStream(EdgeFileReader &reader, int bufferEdges) {
+    int numVertices = reader.NumVertices();
+    int buffer = bufferEdges > 0 ? bufferEdges : (numVertices > 0 ? numVertices : 1);
+    int forestCapacity = numVertices > 1 ? numVertices - 1 : 0;
+    Kruskal::Edge* work = new Kruskal::Edge[forestCapacity + buffer];
+    ConcurrentUnionFind components(numVertices);
+
+    lastEdgesRead = 0;
+    lastBatches = 0;
+    // Work array, the scratch buffer of the edge sort, the union-find and the read buffer
+    lastPeakBytes = 2 * sizeof(Kruskal::Edge) * ((size_t) forestCapacity + buffer)
+                    + sizeof(int) * (size_t) numVertices + EdgeFileReader::BUFFER_SIZE;
+
+    int forest = 0;
+    while (true) {
+        int count = reader.Read(work + forest, buffer);
+        if (count == 0) break;
+        lastEdgesRead += count;
+        lastBatches++;
+
+        EdgeSort::Sort(work, forest + count, Kruskal::sortStrategy);
+        components.Reset();
+        int kept = 0;
+        for (int i = 0; i < forest + count && kept < forestCapacity; i++) {
+            if (components.UniteSequential(work[i].src, work[i].dest)) {
+                work[kept++] = work[i];
+            }
+        }
+        forest = kept;
+    }
+
+    delete[] mst;
+    mst = new Kruskal::Edge[forest > 0 ? forest : 1];
+    mstSize = forest;
+    long long mstWeight = 0;
+    for (int i = 0; i < forest; i++) {
+        mst[i] = work[i];
+        mstWeight += work[i].weight;
+    }
+    delete[] work;
+    return mstWeight;
+}
+
+/**
+ * @brief Returns the peak resident memory of the process.
+ * @return The peak resident set size in bytes, or 0 if unknown.
+ */
+size_t StreamingMST::PeakResidentBytes() {
+#if STREAMING_MST_RUSAGE
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return (size_t) usage.ru_maxrss; // Reported in bytes on macOS
+#else
+    return (size_t) usage.ru_maxrss * 1024; // Reported in kilobytes elsewhere
+#endif
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Streams an edge file (or the loaded graph through a temporary file) and reports memory and throughput.
+ *
+ * With the path "current" the loaded graph is written to a file in the system temporary directory first, and
+ * the streamed forest is checked against Kruskal's algorithm on the adjacency list.
+ *
+ * @param adjList The adjacency list of the loaded graph, used when the path is "current".
+ * @param numVertices The number of vertices of the loaded graph.
+ */
+void StreamingMST::TimeCounterStream(slistEl **adjList, int numVertices) {
+    cout << "Give the path of the edge file (- for standard input, current for the loaded graph): ";
+    string path;
+    cin >> path;
+    cout << "Give the buffer size in edges (0 - one per vertex): ";
+    int bufferEdges;
+    cin >> bufferEdges;
+    cout << endl;
+
+    bool current = path == "current";
+    if (current) {
+        path = (filesystem::temp_directory_path() / "graph_efficiency_edges.txt").string();
+        if (!EdgeFileReader::WriteList(adjList, numVertices, path.c_str())) {
+            cout << "Cannot write " << path << endl;
+            return;
+        }
+    }
+
+    EdgeFileReader reader(path.c_str());
+    if (!reader.IsOpen()) {
+        cout << "Cannot open the file" << endl;
+        return;
+    }
+    auto start = chrono::high_resolution_clock::now();
+    long long mstWeight = AlgorithmCalculationFromStream(reader, bufferEdges);
+    auto end = chrono::high_resolution_clock::now();
+    double elapsed = chrono::duration<double>(end - start).count();
+
+    printf("Edges read: %lld (skipped %lld), batches: %d\n", lastEdgesRead, reader.SkippedEdges(), lastBatches);
+    printf("Forest: %d edges, weight %lld\n", mstSize, mstWeight);
+    printf("Time: %.3f ms, %.2f M edges/s, %.1f ns per edge, %.1f MB/s of input\n", elapsed * 1000,
+           elapsed > 0 ? lastEdgesRead / elapsed / 1e6 : 0.0, lastEdgesRead > 0 ? elapsed * 1e9 / lastEdgesRead : 0.0,
+           elapsed > 0 ? reader.BytesRead() / elapsed / 1e6 : 0.0);
+    printf("Peak working memory: %.2f MB\n", lastPeakBytes / 1e6);
+    if (PeakResidentBytes() > 0) {
+        printf("Process peak resident memory: %.2f MB\n", PeakResidentBytes() / 1e6);
+    }
+
+    if (current) {
+        Kruskal::AlgorithmCalculationFromList(adjList, numVertices);
+        long long expected = 0;
+        for (int i = 0; i < Kruskal::mstSize; i++) {
+            expected += Kruskal::mst[i].weight;
+        }
+        cout << "Kruskal on the loaded graph: weight " << expected
+             << (expected == mstWeight ? " (matches)" : " (differs)") << endl;
+        remove(path.c_str());
+    }
+}
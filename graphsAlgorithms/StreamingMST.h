@@ -0,0 +1,52 @@
+/**
+ * @file StreamingMST.h
+ * @brief This file contains the declaration of the StreamingMST class.
+ */
+
+#ifndef STREAMINGMST_H
+#define STREAMINGMST_H
+
+#include <cstddef>
+#include "Kruskal.h"
+#include "EdgeFileReader.h"
+
+/**
+ * @class StreamingMST
+ * @brief Class computing the minimum spanning forest of an edge stream in one pass with O(V + B) memory.
+ *
+ * Only the current forest (at most V - 1 edges) and a buffer of B edges are kept. Whenever the buffer is full,
+ * Kruskal's algorithm runs on the forest plus the buffer and its result becomes the new forest. An edge dropped
+ * there is the heaviest on a cycle of edges seen so far, so it is not in the minimum spanning forest of the
+ * whole stream. This is the batched form of replacing the heaviest edge on every cycle an edge closes.
+ */
+class StreamingMST {
+public:
+    /**
+     * @brief Computes the minimum spanning forest of all edges left in a reader.
+     * @param reader The open edge file.
+     * @param bufferEdges The number of edges buffered between Kruskal runs; 0 uses one per vertex.
+     * @return The total weight of the forest.
+     */
+    static long long AlgorithmCalculationFromStream(EdgeFileReader &reader, int bufferEdges);
+
+    /**
+     * @brief Streams an edge file (or the loaded graph through a temporary file) and reports memory and throughput.
+     * @param adjList The adjacency list of the loaded graph, used when the path is "current".
+     * @param numVertices The number of vertices of the loaded graph.
+     */
+    static void TimeCounterStream(slistEl **adjList, int numVertices);
+
+    /**
+     * @brief Returns the peak resident memory of the process.
+     * @return The peak resident set size in bytes, or 0 if unknown.
+     */
+    static size_t PeakResidentBytes();
+
+    static Kruskal::Edge* mst; ///< The resulting forest
+    static int mstSize; ///< The number of edges in mst
+    static long long lastEdgesRead; ///< Edges read by the last run
+    static int lastBatches; ///< Kruskal runs of the last run
+    static size_t lastPeakBytes; ///< Largest working memory of the last run: buffer, forest, sort scratch, union-find
+};
+
+#endif // STREAMINGMST_H
@@ -0,0 +1,29 @@
+/**
+ * @file ThreadBarrier.cpp
+ * @brief This file contains the implementation of the ThreadBarrier class.
+ */
+
+#include "ThreadBarrier.h"
+
+using namespace std;
+
+/**
+ * @brief Constructor for the ThreadBarrier class.
+ * @param numThreads The number of threads in the group.
+ */
+ThreadBarrier::ThreadBarrier(int numThreads) : numThreads(numThreads), waiting(0), phase(0) {}
+
+/**
+ * @brief Blocks until every thread of the group has called Wait for the current phase.
+ */
+void ThreadBarrier::Wait() {
+    unique_lock<std::mutex> lock(mutex);
+    unsigned long long arrivedPhase = phase;
+    if (++waiting == numThreads) {
+        waiting = 0;
+        phase++;
+        released.notify_all();
+        return;
+    }
+    released.wait(lock, [&] { return phase != arrivedPhase; });
+}
@@ -0,0 +1,40 @@
+/**
+ * @file ThreadBarrier.h
+ * @brief This file contains the declaration of the ThreadBarrier class.
+ */
+
+#ifndef THREADBARRIER_H
+#define THREADBARRIER_H
+
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * @class ThreadBarrier
+ * @brief Reusable barrier for a fixed group of threads.
+ *
+ * Threads block until all members of the group have arrived. The barrier sleeps on a condition variable instead
+ * of spinning, so oversubscribed runs (more threads than cores) still make progress.
+ */
+class ThreadBarrier {
+public:
+    /**
+     * @brief Constructor for the ThreadBarrier class.
+     * @param numThreads The number of threads in the group.
+     */
+    explicit ThreadBarrier(int numThreads);
+
+    /**
+     * @brief Blocks until every thread of the group has called Wait for the current phase.
+     */
+    void Wait();
+
+private:
+    std::mutex mutex;
+    std::condition_variable released;
+    int numThreads;
+    int waiting; // Threads arrived in the current phase
+    unsigned long long phase; // Completed phases, so a late wakeup cannot confuse two phases
+};
+
+#endif // THREADBARRIER_H